@@ -0,0 +1,240 @@
+#ifndef ANNEALING_SCHEDULE_H
+#define ANNEALING_SCHEDULE_H
+
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <algorithm>
+
+// Parâmetros da têmpera simulada. Com adaptive = false valem initialTemp e
+// coolingRate como dados (resfriamento geométrico fixo). Com adaptive = true:
+//  - a temperatura inicial é calibrada pelas pioras de custo de movimentos
+//    sorteados na coloração inicial, para que a piora média seja aceita com
+//    probabilidade initialAcceptance (T0 = -média / ln(initialAcceptance));
+//  - a taxa de resfriamento é a que leva T0 até a temperatura em que essa piora é
+//    aceita com probabilidade finalAcceptance exatamente em maxIterations (sem
+//    limite de iterações, vale coolingRate);
+//  - após plateauFraction * maxIterations iterações sem melhorar a melhor solução
+//    (platô), a temperatura volta a reheatFraction * T0.
+struct AnnealingParameters
+{
+    double initialTemp = 1000.0;
+    double coolingRate = 0.99;
+    int maxIterations = 10000;
+    bool adaptive = false;
+    double initialAcceptance = 0.8;
+    double finalAcceptance = 0.001;
+    double plateauFraction = 0.05;
+    double reheatFraction = 0.5;
+
+    // Parâmetros adaptativos com os valores padrão acima.
+    static AnnealingParameters adaptiveDefaults(int maxIterations = 10000)
+    {
+        AnnealingParameters parameters;
+        parameters.adaptive = true;
+        parameters.maxIterations = maxIterations;
+        return parameters;
+    }
+
+    // "chave=valor" separados por espaço, no formato lido por parse.
+    std::string describe() const
+    {
+        std::ostringstream text;
+        text << "adaptive=" << (adaptive ? 1 : 0) << " initialTemp=" << initialTemp << " coolingRate=" << coolingRate
+             << " iterations=" << maxIterations << " initialAcceptance=" << initialAcceptance
+             << " finalAcceptance=" << finalAcceptance << " plateau=" << plateauFraction << " reheat=" << reheatFraction;
+        return text.str();
+    }
+
+    static AnnealingParameters parse(std::istream &in)
+    {
+        AnnealingParameters parameters;
+        std::string field;
+        while (in >> field)
+        {
+            size_t equals = field.find('=');
+            if (equals == std::string::npos)
+                throw std::runtime_error("parâmetro sem valor: " + field);
+            std::string key = field.substr(0, equals);
+            double value = std::stod(field.substr(equals + 1));
+            if (key == "adaptive")
+                parameters.adaptive = value != 0;
+            else if (key == "initialTemp")
+                parameters.initialTemp = value;
+            else if (key == "coolingRate")
+                parameters.coolingRate = value;
+            else if (key == "iterations")
+                parameters.maxIterations = static_cast<int>(value);
+            else if (key == "initialAcceptance")
+                parameters.initialAcceptance = value;
+            else if (key == "finalAcceptance")
+                parameters.finalAcceptance = value;
+            else if (key == "plateau")
+                parameters.plateauFraction = value;
+            else if (key == "reheat")
+                parameters.reheatFraction = value;
+            else
+                throw std::runtime_error("parâmetro desconhecido: " + key);
+        }
+        return parameters;
+    }
+};
+
+// Temperatura ao longo de uma execução. Sem adaptive reproduz o resfriamento
+// geométrico de sempre: T0 = initialTemp e T *= coolingRate a cada iteração.
+class CoolingSchedule
+{
+public:
+    static constexpr int CALIBRATION_SAMPLES = 100;
+    static constexpr int MIN_PLATEAU = 100;
+    static constexpr int UNBOUNDED_PLATEAU = 5000; // platô quando não há limite de iterações
+
+    explicit CoolingSchedule(const AnnealingParameters &parameters)
+        : parameters(parameters), startTemperature(parameters.initialTemp), rate(parameters.coolingRate)
+    {
+        if (parameters.adaptive)
+        {
+            plateauLength = parameters.maxIterations > 0
+                                ? std::max(MIN_PLATEAU, static_cast<int>(parameters.plateauFraction * parameters.maxIterations))
+                                : UNBOUNDED_PLATEAU;
+        }
+    }
+
+    // Recebe as pioras (> 0) de custo observadas nos movimentos sorteados. Sem
+    // nenhuma, supõe piora média 1 (a menor possível com custo inteiro).
+    void calibrate(const std::vector<int> &worseningDeltas)
+    {
+        if (!parameters.adaptive)
+            return;
+
+        double meanDelta = 1.0;
+        if (!worseningDeltas.empty())
+        {
+            double sum = 0;
+            for (int delta : worseningDeltas)
+                sum += delta;
+            meanDelta = sum / worseningDeltas.size();
+        }
+
+        startTemperature = -meanDelta / std::log(parameters.initialAcceptance);
+        if (parameters.maxIterations > 0)
+        {
+            double finalTemperature = -meanDelta / std::log(parameters.finalAcceptance);
+            rate = std::pow(finalTemperature / startTemperature, 1.0 / parameters.maxIterations);
+        }
+    }
+
+    // Retoma uma execução interrompida com a temperatura inicial e a taxa já calibradas.
+    void restore(double initialTemperature, double coolingRate)
+    {
+        startTemperature = initialTemperature;
+        rate = coolingRate;
+    }
+
+    double initialTemperature() const { return startTemperature; }
+    double coolingRate() const { return rate; }
+    int getReheats() const { return reheats; }
+
+    // Temperatura da próxima iteração; improvedBest diz se a iteração atual melhorou a melhor solução.
+    double next(double temperature, bool improvedBest)
+    {
+        temperature *= rate;
+        if (!parameters.adaptive)
+            return temperature;
+
+        sinceImprovement = improvedBest ? 0 : sinceImprovement + 1;
+        if (sinceImprovement >= plateauLength)
+        {
+            sinceImprovement = 0;
+            double reheatTemperature = parameters.reheatFraction * startTemperature;
+            if (temperature < reheatTemperature)
+            {
+                temperature = reheatTemperature;
+                ++reheats;
+            }
+        }
+        return temperature;
+    }
+
+private:
+    AnnealingParameters parameters;
+    double startTemperature;
+    double rate;
+    int plateauLength = 0;
+    int sinceImprovement = 0;
+    int reheats = 0;
+};
+
+// Parâmetros vencedores por família de instâncias e vizinhança, gravados pelo Tuner.
+// Uma linha por par: "<família> <vizinhança> chave=valor ...". Linhas em branco e
+// começadas por '#' são ignoradas.
+namespace AnnealingTuning
+{
+    using Table = std::map<std::pair<std::string, int>, AnnealingParameters>;
+
+    // Família pelo último trecho do nome antes da extensão: Instance3_450_LEI.txt -> LEI.
+    inline std::string familyOf(const std::string &filename)
+    {
+        std::string name = filename.substr(filename.find_last_of("/\\") + 1);
+        name = name.substr(0, name.find('.'));
+        size_t underscore = name.find_last_of('_');
+        return underscore == std::string::npos ? name : name.substr(underscore + 1);
+    }
+
+    inline Table load(const std::string &path)
+    {
+        std::ifstream in(path);
+        if (!in.is_open())
+            throw std::runtime_error(path + ": não foi possível abrir o arquivo de parâmetros");
+
+        Table table;
+        std::string line;
+        int lineNumber = 0;
+        while (std::getline(in, line))
+        {
+            ++lineNumber;
+            if (line.empty() || line[0] == '#')
+                continue;
+
+            std::istringstream fields(line);
+            std::string family;
+            int neighborhood = 0;
+            if (!(fields >> family >> neighborhood))
+                throw std::runtime_error(path + ":" + std::to_string(lineNumber) + ": linha inválida");
+            try
+            {
+                table[{family, neighborhood}] = AnnealingParameters::parse(fields);
+            }
+            catch (const std::exception &e)
+            {
+                throw std::runtime_error(path + ":" + std::to_string(lineNumber) + ": " + e.what());
+            }
+        }
+        return table;
+    }
+
+    inline void save(const std::string &path, const Table &table)
+    {
+        std::ofstream out(path, std::ios::trunc);
+        if (!out.is_open())
+            throw std::runtime_error(path + ": não foi possível gravar o arquivo de parâmetros");
+        out << "# família vizinhança parâmetros (gerado pelo Tuner)\n";
+        for (const auto &entry : table)
+            out << entry.first.first << ' ' << entry.first.second << ' ' << entry.second.describe() << "\n";
+    }
+
+    // Parâmetros da família/vizinhança, ou `fallback` se o arquivo não os tiver.
+    inline AnnealingParameters lookup(const Table &table, const std::string &family, int neighborhood,
+                                      const AnnealingParameters &fallback)
+    {
+        auto it = table.find({family, neighborhood});
+        return it != table.end() ? it->second : fallback;
+    }
+}
+
+#endif // ANNEALING_SCHEDULE_H
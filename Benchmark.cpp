@@ -0,0 +1,585 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cctype>
+#include <filesystem>
+#include <functional>
+#include <stdexcept>
+#include "InstanceReader.h"
+#include "Graph.h"
+#include "GraphColoring_LocalSearch.h"
+#include "GraphColoring_SimulatedAnnealing.h"
+#include "GraphColoring_TabuCol.h"
+#include "ColoringVerifier.h"
+#include "Random.h"
+#include "TextFormat.h"
+
+// Bateria de desempenho reprodutível: roda cada solver/vizinhança sobre as
+// instâncias com sementes fixas e várias repetições, resume tempo, iterações/s,
+// cores e colisões e, opcionalmente, compara com uma baseline em JSON.
+//
+// Uso: Benchmark [opções] [instância ...]
+//   --instances <dir>       diretório das instâncias (padrão ../Instances)
+//   --repetitions <n>       repetições por configuração (padrão 5)
+//   --seed <s>              semente mestre (padrão 20250119)
+//   --sa-iterations <n>     iterações da têmpera simulada (padrão 10000)
+//   --tabu-iterations <n>   iterações do TabuCol (padrão 200000, sem limite de tempo)
+//   --filter <texto>        só instâncias cujo nome contém o texto
+//   --save <arquivo.json>   grava os resultados como baseline
+//   --baseline <arquivo>    compara com uma baseline gravada antes
+//   --tolerance <fração>    folga de tempo antes de acusar regressão (padrão 0.10)
+//
+// Sai com código 2 se alguma configuração regrediu em relação à baseline.
+
+struct RunSample
+{
+    double wallMs = 0;
+    long long iterations = 0;
+    int colors = 0;
+    int conflicts = 0;
+};
+
+struct BenchmarkSummary
+{
+    std::string instance;
+    std::string solver;
+    int runs = 0;
+    double medianMs = 0;
+    double p10Ms = 0;
+    double p90Ms = 0;
+    double minMs = 0;
+    double maxMs = 0;
+    double iterationsPerSecond = 0;
+    int colors = 0;    // mediana
+    int bestColors = 0;
+    int conflicts = 0; // mediana
+};
+
+struct BenchmarkOptions
+{
+    std::string instancesDir = "../Instances";
+    std::vector<std::string> instances;
+    int repetitions = 5;
+    uint64_t seed = 20250119;
+    int annealingIterations = 10000;
+    long long tabuIterations = 200000;
+    std::string filter;
+    std::string savePath;
+    std::string baselinePath;
+    double tolerance = 0.10;
+};
+
+// Abaixo deste ganho absoluto (ms) uma diferença de tempo é tratada como ruído.
+const double TIME_NOISE_FLOOR_MS = 0.05;
+
+double percentile(std::vector<double> values, double fraction)
+{
+    if (values.empty())
+        return 0;
+    std::sort(values.begin(), values.end());
+    double position = fraction * (values.size() - 1);
+    size_t lower = static_cast<size_t>(position);
+    size_t upper = std::min(lower + 1, values.size() - 1);
+    return values[lower] + (values[upper] - values[lower]) * (position - lower);
+}
+
+int medianOf(std::vector<int> values)
+{
+    std::sort(values.begin(), values.end());
+    return values.empty() ? 0 : values[values.size() / 2];
+}
+
+BenchmarkSummary summarize(const std::string &instance, const std::string &solver, const std::vector<RunSample> &samples)
+{
+    BenchmarkSummary summary;
+    summary.instance = instance;
+    summary.solver = solver;
+    summary.runs = static_cast<int>(samples.size());
+
+    std::vector<double> times;
+    std::vector<int> colors;
+    std::vector<int> conflicts;
+    double totalSeconds = 0;
+    long long totalIterations = 0;
+    for (const RunSample &sample : samples)
+    {
+        times.push_back(sample.wallMs);
+        colors.push_back(sample.colors);
+        conflicts.push_back(sample.conflicts);
+        totalSeconds += sample.wallMs / 1000.0;
+        totalIterations += sample.iterations;
+    }
+
+    summary.medianMs = percentile(times, 0.5);
+    summary.p10Ms = percentile(times, 0.1);
+    summary.p90Ms = percentile(times, 0.9);
+    summary.minMs = *std::min_element(times.begin(), times.end());
+    summary.maxMs = *std::max_element(times.begin(), times.end());
+    summary.iterationsPerSecond = totalSeconds > 0 ? totalIterations / totalSeconds : 0;
+    summary.colors = medianOf(colors);
+    summary.bestColors = *std::min_element(colors.begin(), colors.end());
+    summary.conflicts = medianOf(conflicts);
+    return summary;
+}
+
+// Uma configuração executa uma repetição (semente já derivada) e devolve a amostra.
+struct SolverConfig
+{
+    std::string name;
+    std::function<RunSample(const Graph &, uint64_t)> run;
+};
+
+template <typename Body>
+double measureMs(Body body)
+{
+    auto start = std::chrono::steady_clock::now();
+    body();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::vector<SolverConfig> makeConfigs(const BenchmarkOptions &options)
+{
+    std::vector<SolverConfig> configs;
+
+    // Busca local: a coloração inicial fica fora da medição, só a vizinhança conta
+    const char *localSearchNames[6] = {"LS-N1-first", "LS-N1-best", "LS-N2-first", "LS-N2-best", "LS-N3-first", "LS-N3-best"};
+    for (int k = 0; k < 6; ++k)
+    {
+        configs.push_back({localSearchNames[k], [k](const Graph &graph, uint64_t)
+                           {
+                               std::ostringstream discard;
+                               GraphColoring_LocalSearch localSearch(graph, discard);
+                               localSearch.initialColoring();
+
+                               RunSample sample;
+                               std::vector<int> result;
+                               bool firstImprovement = k % 2 == 0;
+                               sample.wallMs = measureMs([&]
+                                                         { result = k < 2   ? localSearch.neighborhood1(firstImprovement)
+                                                                    : k < 4 ? localSearch.neighborhood2(firstImprovement)
+                                                                            : localSearch.neighborhood3(firstImprovement); });
+                               sample.iterations = localSearch.getIterations();
+                               ColoringReport report = ColoringVerifier(graph).verify(result);
+                               sample.colors = report.colorSpan();
+                               sample.conflicts = static_cast<int>(report.conflicts);
+                               return sample;
+                           }});
+    }
+
+    // Têmpera simulada: cada vizinhança com Metropolis e com threshold accepting
+    for (AcceptanceRule rule : {AcceptanceRule::Metropolis, AcceptanceRule::Threshold})
+    {
+        for (int k = 1; k <= 4; ++k)
+        {
+            int iterations = options.annealingIterations;
+            std::string name = "SA-N" + std::to_string(k) + (rule == AcceptanceRule::Threshold ? "-threshold" : "");
+            configs.push_back({name, [k, rule, iterations](const Graph &graph, uint64_t seed)
+                               {
+                                   std::ostringstream discard;
+                                   GraphColoring_SimulatedAnnealing annealing(graph, 1000.0, 0.99, iterations, discard);
+                                   annealing.setSeed(seed);
+                                   annealing.setAcceptance(rule);
+
+                                   RunSample sample;
+                                   sample.wallMs = measureMs([&]
+                                                             { annealing.simulatedAnnealing(k); });
+                                   sample.iterations = annealing.getIterations();
+                                   sample.colors = annealing.getVerification().colorSpan();
+                                   sample.conflicts = static_cast<int>(annealing.getVerification().conflicts);
+                                   return sample;
+                               }});
+        }
+    }
+
+    // TabuCol só com orçamento de iterações: o resultado não depende da máquina
+    long long tabuIterations = options.tabuIterations;
+    configs.push_back({"TabuCol", [tabuIterations](const Graph &graph, uint64_t seed)
+                       {
+                           std::ostringstream discard;
+                           GraphColoring_TabuCol tabuCol(graph, 0, tabuIterations, discard);
+                           tabuCol.setSeed(seed);
+
+                           RunSample sample;
+                           sample.wallMs = measureMs([&]
+                                                     { tabuCol.tabuCol(); });
+                           sample.iterations = tabuCol.getIterations();
+                           sample.colors = tabuCol.getVerification().colorSpan();
+                           sample.conflicts = static_cast<int>(tabuCol.getVerification().conflicts);
+                           return sample;
+                       }});
+
+    return configs;
+}
+
+void saveBaseline(const std::string &path, const BenchmarkOptions &options, const std::vector<BenchmarkSummary> &summaries)
+{
+    std::ofstream file(path);
+    if (!file.is_open())
+        throw std::runtime_error(path + ": não foi possível gravar a baseline");
+
+    file << std::setprecision(10);
+    file << "{\n  \"version\": 1,\n  \"seed\": " << options.seed << ",\n  \"repetitions\": " << options.repetitions
+         << ",\n  \"results\": [\n";
+    for (size_t i = 0; i < summaries.size(); ++i)
+    {
+        const BenchmarkSummary &s = summaries[i];
+        file << "    {\"instance\": \"" << TextFormat::escapeJson(s.instance) << "\", \"solver\": \"" << TextFormat::escapeJson(s.solver)
+             << "\", \"runs\": " << s.runs << ", \"medianMs\": " << s.medianMs << ", \"p10Ms\": " << s.p10Ms
+             << ", \"p90Ms\": " << s.p90Ms << ", \"minMs\": " << s.minMs << ", \"maxMs\": " << s.maxMs
+             << ", \"iterationsPerSecond\": " << s.iterationsPerSecond << ", \"colors\": " << s.colors
+             << ", \"bestColors\": " << s.bestColors << ", \"conflicts\": " << s.conflicts << "}"
+             << (i + 1 < summaries.size() ? "," : "") << "\n";
+    }
+    file << "  ]\n}\n";
+}
+
+// Leitor JSON mínimo para o formato gravado por saveBaseline: objeto de topo com
+// uma lista "results" de objetos planos (strings e números). Outras chaves são ignoradas.
+class BaselineReader
+{
+public:
+    explicit BaselineReader(const std::string &path) : path(path)
+    {
+        std::ifstream file(path);
+        if (!file.is_open())
+            throw std::runtime_error(path + ": não foi possível abrir a baseline");
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        text = buffer.str();
+    }
+
+    std::map<std::string, BenchmarkSummary> read()
+    {
+        std::map<std::string, BenchmarkSummary> entries;
+        expect('{');
+        while (!consume('}'))
+        {
+            std::string key = parseString();
+            expect(':');
+            if (key == "results")
+            {
+                expect('[');
+                while (!consume(']'))
+                {
+                    BenchmarkSummary entry = parseEntry();
+                    entries[entry.instance + "/" + entry.solver] = entry;
+                    consume(',');
+                }
+            }
+            else
+            {
+                skipValue();
+            }
+            consume(',');
+        }
+        return entries;
+    }
+
+private:
+    std::string path;
+    std::string text;
+    size_t pos = 0;
+
+    [[noreturn]] void fail(const std::string &message) const
+    {
+        throw std::runtime_error(path + ": " + message + " (posição " + std::to_string(pos) + ")");
+    }
+
+    void skipWhitespace()
+    {
+        while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos])))
+            ++pos;
+    }
+
+    bool consume(char c)
+    {
+        skipWhitespace();
+        if (pos < text.size() && text[pos] == c)
+        {
+            ++pos;
+            return true;
+        }
+        return false;
+    }
+
+    void expect(char c)
+    {
+        if (!consume(c))
+            fail(std::string("esperado '") + c + "'");
+    }
+
+    std::string parseString()
+    {
+        expect('"');
+        std::string value;
+        while (pos < text.size() && text[pos] != '"')
+        {
+            if (text[pos] == '\\' && pos + 1 < text.size())
+                ++pos;
+            value += text[pos++];
+        }
+        expect('"');
+        return value;
+    }
+
+    double parseNumber()
+    {
+        skipWhitespace();
+        const char *first = text.c_str() + pos;
+        char *last = nullptr;
+        double value = std::strtod(first, &last);
+        if (last == first)
+            fail("número inválido");
+        pos += last - first;
+        return value;
+    }
+
+    void skipValue()
+    {
+        skipWhitespace();
+        if (pos >= text.size())
+            fail("fim inesperado");
+        if (text[pos] == '"')
+        {
+            parseString();
+        }
+        else if (text[pos] == '{' || text[pos] == '[')
+        {
+            char close = text[pos] == '{' ? '}' : ']';
+            ++pos;
+            while (!consume(close))
+            {
+                if (close == '}')
+                {
+                    parseString();
+                    expect(':');
+                }
+                skipValue();
+                consume(',');
+            }
+        }
+        else if (std::isalpha(static_cast<unsigned char>(text[pos])))
+        {
+            while (pos < text.size() && std::isalpha(static_cast<unsigned char>(text[pos])))
+                ++pos;
+        }
+        else
+        {
+            parseNumber();
+        }
+    }
+
+    BenchmarkSummary parseEntry()
+    {
+        BenchmarkSummary entry;
+        expect('{');
+        while (!consume('}'))
+        {
+            std::string key = parseString();
+            expect(':');
+            if (key == "instance")
+                entry.instance = parseString();
+            else if (key == "solver")
+                entry.solver = parseString();
+            else if (key == "medianMs")
+                entry.medianMs = parseNumber();
+            else if (key == "p10Ms")
+                entry.p10Ms = parseNumber();
+            else if (key == "p90Ms")
+                entry.p90Ms = parseNumber();
+            else if (key == "iterationsPerSecond")
+                entry.iterationsPerSecond = parseNumber();
+            else if (key == "colors")
+                entry.colors = static_cast<int>(parseNumber());
+            else if (key == "bestColors")
+                entry.bestColors = static_cast<int>(parseNumber());
+            else if (key == "conflicts")
+                entry.conflicts = static_cast<int>(parseNumber());
+            else
+                skipValue();
+            consume(',');
+        }
+        return entry;
+    }
+};
+
+// Compara com a baseline e imprime uma linha por configuração. Tempo regride se a
+// mediana passar da tolerância (e do piso de ruído); qualidade regride se a
+// mediana de cores ou de colisões piorar. Devolve o número de regressões.
+int compareWithBaseline(const std::vector<BenchmarkSummary> &summaries, const std::map<std::string, BenchmarkSummary> &baseline,
+                        double tolerance)
+{
+    int regressions = 0;
+    std::cout << "\n=== Comparação com a baseline ===\n";
+    for (const BenchmarkSummary &s : summaries)
+    {
+        auto it = baseline.find(s.instance + "/" + s.solver);
+        if (it == baseline.end())
+        {
+            std::cout << std::left << std::setw(28) << s.instance << std::setw(13) << s.solver << " sem baseline\n";
+            continue;
+        }
+
+        const BenchmarkSummary &base = it->second;
+        double ratio = base.medianMs > 0 ? s.medianMs / base.medianMs : 1.0;
+        bool slower = ratio > 1.0 + tolerance && s.medianMs - base.medianMs > TIME_NOISE_FLOOR_MS;
+        bool faster = ratio < 1.0 - tolerance && base.medianMs - s.medianMs > TIME_NOISE_FLOOR_MS;
+        bool worseQuality = s.colors > base.colors || s.conflicts > base.conflicts;
+        bool betterQuality = s.colors < base.colors || (s.colors == base.colors && s.conflicts < base.conflicts);
+
+        std::string verdict = "ok";
+        if (slower || worseQuality)
+        {
+            verdict = slower && worseQuality ? "REGRESSÃO (tempo e qualidade)" : slower ? "REGRESSÃO (tempo)"
+                                                                                       : "REGRESSÃO (qualidade)";
+            ++regressions;
+        }
+        else if (faster || betterQuality)
+        {
+            verdict = "melhora";
+        }
+
+        std::cout << std::left << std::setw(28) << s.instance << std::setw(13) << s.solver << std::right << std::fixed
+                  << std::setprecision(3) << std::setw(10) << base.medianMs << " -> " << std::setw(10) << s.medianMs
+                  << " ms (" << std::showpos << std::setprecision(1) << (ratio - 1.0) * 100 << "%" << std::noshowpos
+                  << "), cores " << base.colors << " -> " << s.colors << ", colisões " << base.conflicts << " -> "
+                  << s.conflicts << "  " << verdict << "\n";
+    }
+    std::cout << regressions << " regressão(ões).\n";
+    return regressions;
+}
+
+BenchmarkOptions parseOptions(int argc, char **argv)
+{
+    BenchmarkOptions options;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        auto value = [&]() -> std::string
+        {
+            if (i + 1 >= argc)
+                throw std::runtime_error("faltou o valor de " + arg);
+            return argv[++i];
+        };
+
+        if (arg == "--instances")
+            options.instancesDir = value();
+        else if (arg == "--repetitions")
+            options.repetitions = std::max(1, std::stoi(value()));
+        else if (arg == "--seed")
+            options.seed = std::stoull(value());
+        else if (arg == "--sa-iterations")
+            options.annealingIterations = std::stoi(value());
+        else if (arg == "--tabu-iterations")
+            options.tabuIterations = std::stoll(value());
+        else if (arg == "--filter")
+            options.filter = value();
+        else if (arg == "--save")
+            options.savePath = value();
+        else if (arg == "--baseline")
+            options.baselinePath = value();
+        else if (arg == "--tolerance")
+            options.tolerance = std::stod(value());
+        else if (!arg.empty() && arg[0] == '-')
+            throw std::runtime_error("opção desconhecida: " + arg);
+        else
+            options.instances.push_back(arg);
+    }
+
+    if (options.instances.empty())
+    {
+        for (const auto &entry : std::filesystem::directory_iterator(options.instancesDir))
+        {
+            std::string extension = entry.path().extension().string();
+            if (entry.is_regular_file() && (extension == ".txt" || extension == ".col"))
+                options.instances.push_back(entry.path().string());
+        }
+        std::sort(options.instances.begin(), options.instances.end());
+    }
+    return options;
+}
+
+int main(int argc, char **argv)
+{
+    BenchmarkOptions options;
+    try
+    {
+        options = parseOptions(argc, argv);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Erro: " << e.what() << "\n";
+        return 1;
+    }
+
+    std::vector<SolverConfig> configs = makeConfigs(options);
+    std::vector<BenchmarkSummary> summaries;
+
+    std::cout << std::left << std::setw(28) << "instância" << std::setw(13) << "solver" << std::right << std::setw(10)
+              << "mediana" << std::setw(10) << "p10" << std::setw(10) << "p90" << std::setw(14) << "iter/s"
+              << std::setw(7) << "cores" << std::setw(10) << "colisões" << "\n";
+
+    for (size_t i = 0; i < options.instances.size(); ++i)
+    {
+        const std::string &path = options.instances[i];
+        std::string name = std::filesystem::path(path).filename().string();
+        if (!options.filter.empty() && name.find(options.filter) == std::string::npos)
+            continue;
+
+        Graph graph(0, {});
+        try
+        {
+            InstanceReader reader(path);
+            graph = reader.takeGraph();
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Erro ao ler " << path << ": " << e.what() << "\n";
+            continue;
+        }
+
+        for (size_t c = 0; c < configs.size(); ++c)
+        {
+            std::vector<RunSample> samples;
+            for (int rep = 0; rep < options.repetitions; ++rep)
+            {
+                // A semente depende só da configuração e da repetição, não da ordem das instâncias
+                uint64_t seed = Xoshiro256::deriveSeed(Xoshiro256::deriveSeed(options.seed, c), rep);
+                samples.push_back(configs[c].run(graph, seed));
+            }
+
+            BenchmarkSummary s = summarize(name, configs[c].name, samples);
+            std::cout << std::left << std::setw(28) << s.instance << std::setw(13) << s.solver << std::right << std::fixed
+                      << std::setprecision(3) << std::setw(10) << s.medianMs << std::setw(10) << s.p10Ms << std::setw(10)
+                      << s.p90Ms << std::setprecision(0) << std::setw(14) << s.iterationsPerSecond << std::setw(7)
+                      << s.colors << std::setw(10) << s.conflicts << "\n";
+            summaries.push_back(s);
+        }
+    }
+
+    int regressions = 0;
+    try
+    {
+        if (!options.baselinePath.empty())
+            regressions = compareWithBaseline(summaries, BaselineReader(options.baselinePath).read(), options.tolerance);
+        if (!options.savePath.empty())
+        {
+            saveBaseline(options.savePath, options, summaries);
+            std::cout << "Baseline salva em " << options.savePath << "\n";
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Erro: " << e.what() << "\n";
+        return 1;
+    }
+
+    return regressions == 0 ? 0 : 2;
+}
@@ -0,0 +1,155 @@
+#ifndef BITSET_GRAPH_H
+#define BITSET_GRAPH_H
+
+#include <vector>
+#include <cstdint>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// Núcleos AND + popcount sobre bitsets de 64 bits. Com AVX2 habilitado na
+// compilação (-mavx2 / -march=native) o popcount de blocos de 256 bits usa a
+// tabela de nibbles com vpshufb (Mula); sem ele, popcount escalar por palavra.
+namespace BitsetKernels
+{
+    inline int popcount64(uint64_t x)
+    {
+#if defined(_MSC_VER) && defined(_M_X64)
+        return static_cast<int>(__popcnt64(x));
+#elif defined(__GNUC__)
+        return __builtin_popcountll(x);
+#else
+        int count = 0;
+        for (; x; x &= x - 1)
+            ++count;
+        return count;
+#endif
+    }
+
+    inline int countTrailingZeros64(uint64_t x)
+    {
+#if defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index;
+        _BitScanForward64(&index, x);
+        return static_cast<int>(index);
+#elif defined(__GNUC__)
+        return __builtin_ctzll(x);
+#else
+        int count = 0;
+        while ((x & 1) == 0)
+        {
+            x >>= 1;
+            ++count;
+        }
+        return count;
+#endif
+    }
+
+#ifdef __AVX2__
+    inline __m256i popcount256(__m256i v)
+    {
+        const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i low = _mm256_set1_epi8(0x0F);
+        __m256i lo = _mm256_and_si256(v, low);
+        __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low);
+        __m256i bytes = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo), _mm256_shuffle_epi8(lookup, hi));
+        return _mm256_sad_epu8(bytes, _mm256_setzero_si256());
+    }
+#endif
+
+    // popcount(a AND b) sobre `words` palavras.
+    inline int andPopcount(const uint64_t *a, const uint64_t *b, int words)
+    {
+        int i = 0;
+        int count = 0;
+#ifdef __AVX2__
+        __m256i total = _mm256_setzero_si256();
+        for (; i + 4 <= words; i += 4)
+        {
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+            __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+            total = _mm256_add_epi64(total, popcount256(_mm256_and_si256(x, y)));
+        }
+        alignas(32) uint64_t lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), total);
+        count = static_cast<int>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+#endif
+        for (; i < words; ++i)
+            count += popcount64(a[i] & b[i]);
+        return count;
+    }
+
+    // (a AND b) != 0, com saída antecipada.
+    inline bool intersects(const uint64_t *a, const uint64_t *b, int words)
+    {
+        int i = 0;
+#ifdef __AVX2__
+        for (; i + 4 <= words; i += 4)
+        {
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+            __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+            if (!_mm256_testz_si256(x, y))
+                return true;
+        }
+#endif
+        for (; i < words; ++i)
+        {
+            if (a[i] & b[i])
+                return true;
+        }
+        return false;
+    }
+}
+
+// Matriz de adjacência em bitsets (uma linha de n bits por vértice). Usada como
+// backend alternativo do Graph quando o grafo é denso: contar vizinhos de v com a
+// cor c vira popcount(linha(v) AND classe(c)), sem percorrer a lista de vizinhos.
+class DenseAdjacency
+{
+public:
+    // Densidade mínima e tamanho máximo (memória n²/8 bytes) para usar o backend.
+    static bool preferredFor(int n, long long undirectedEdges)
+    {
+        if (n < 64 || n > 16384)
+            return false;
+        double density = 2.0 * static_cast<double>(undirectedEdges) / (static_cast<double>(n) * (n - 1));
+        return density >= 0.05;
+    }
+
+    static int wordsFor(int n)
+    {
+        return ((n + 63) / 64 + 3) & ~3; // Múltiplo de 4 palavras (256 bits)
+    }
+
+    DenseAdjacency(int n, const std::vector<int> &csrOffsets, const std::vector<int> &csrNeighbors)
+        : n(n), words(wordsFor(n)), bits(static_cast<size_t>(n) * words, 0)
+    {
+        for (int v = 0; v < n; ++v)
+        {
+            uint64_t *line = &bits[static_cast<size_t>(v) * words];
+            for (int i = csrOffsets[v]; i < csrOffsets[v + 1]; ++i)
+                line[csrNeighbors[i] >> 6] |= uint64_t(1) << (csrNeighbors[i] & 63);
+        }
+    }
+
+    int getNumVertices() const { return n; }
+    int wordsPerRow() const { return words; }
+    const uint64_t *row(int v) const { return &bits[static_cast<size_t>(v) * words]; }
+
+    bool hasEdge(int u, int v) const
+    {
+        return (row(u)[v >> 6] >> (v & 63)) & 1;
+    }
+
+private:
+    int n;
+    int words;
+    std::vector<uint64_t> bits;
+};
+
+#endif // BITSET_GRAPH_H
@@ -0,0 +1,91 @@
+#ifndef BUCKET_QUEUE_H
+#define BUCKET_QUEUE_H
+
+#include <vector>
+
+// Fila de prioridade por baldes para itens 0..numItems-1 com chaves inteiras em
+// [minKey, maxKey]. Inserir, remover e mudar a chave custam O(1); a menor chave
+// é encontrada por um cursor que só avança sobre baldes vazios (O(1) amortizado).
+class BucketQueue
+{
+public:
+    void reset(int numItems, int minKey, int maxKey)
+    {
+        keyOffset = minKey;
+        head.assign(maxKey - minKey + 1, -1);
+        next.assign(numItems, -1);
+        prev.assign(numItems, -1);
+        keyOf.assign(numItems, 0);
+        present.assign(numItems, 0);
+        cursor = static_cast<int>(head.size());
+        count = 0;
+    }
+
+    bool empty() const { return count == 0; }
+    int size() const { return count; }
+    bool contains(int item) const { return present[item] != 0; }
+    int key(int item) const { return keyOf[item]; }
+
+    void insert(int item, int key)
+    {
+        int bucket = key - keyOffset;
+        keyOf[item] = key;
+        present[item] = 1;
+        prev[item] = -1;
+        next[item] = head[bucket];
+        if (head[bucket] != -1)
+            prev[head[bucket]] = item;
+        head[bucket] = item;
+        if (bucket < cursor)
+            cursor = bucket;
+        ++count;
+    }
+
+    void remove(int item)
+    {
+        if (!present[item])
+            return;
+
+        int bucket = keyOf[item] - keyOffset;
+        if (prev[item] != -1)
+            next[prev[item]] = next[item];
+        else
+            head[bucket] = next[item];
+        if (next[item] != -1)
+            prev[next[item]] = prev[item];
+        present[item] = 0;
+        --count;
+    }
+
+    void update(int item, int key)
+    {
+        remove(item);
+        insert(item, key);
+    }
+
+    // Menor chave presente; a fila não pode estar vazia.
+    int minKey()
+    {
+        while (head[cursor] == -1)
+            ++cursor;
+        return cursor + keyOffset;
+    }
+
+    // Um item com a menor chave (o inserido por último nesse balde).
+    int top()
+    {
+        return head[minKey() - keyOffset];
+    }
+
+private:
+    int keyOffset = 0;
+    int cursor = 0;
+    int count = 0;
+    std::vector<int> head;
+    std::vector<int> next;
+    std::vector<int> prev;
+    std::vector<int> keyOf;
+    std::vector<char> present;
+};
+
+#endif // BUCKET_QUEUE_H
@@ -0,0 +1,318 @@
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <ostream>
+#include "Graph.h"
+#include "GraphCache.h"
+#include "ResultWriter.h"
+
+// Identifica o grafo dos solvers: o CSR já reflete a redução e a renumeração, então
+// mudar qualquer uma das duas entre execuções muda o hash.
+struct GraphFingerprint
+{
+    int32_t numVertices = 0;
+    int64_t numEdges = 0;
+    uint64_t csrHash = 0; // FNV-1a sobre offsets e vizinhos
+
+    static GraphFingerprint of(const Graph &graph)
+    {
+        GraphFingerprint fingerprint;
+        fingerprint.numVertices = graph.getNumVertices();
+        fingerprint.numEdges = static_cast<int64_t>(graph.getNeighbors().size() / 2);
+        const std::vector<int> &offsets = graph.getOffsets();
+        const std::vector<int> &neighbors = graph.getNeighbors();
+        uint64_t offsetsHash = GraphCache::hashBytes(reinterpret_cast<const char *>(offsets.data()), offsets.size() * sizeof(int));
+        uint64_t neighborsHash = GraphCache::hashBytes(reinterpret_cast<const char *>(neighbors.data()), neighbors.size() * sizeof(int));
+        fingerprint.csrHash = offsetsHash ^ (neighborsHash * 1099511628211ULL);
+        return fingerprint;
+    }
+
+    bool operator==(const GraphFingerprint &other) const
+    {
+        return numVertices == other.numVertices && numEdges == other.numEdges && csrHash == other.csrHash;
+    }
+    bool operator!=(const GraphFingerprint &other) const { return !(*this == other); }
+};
+
+// Estado de um solver interrompido, suficiente para continuar a busca de onde
+// parou. Os campos que não se aplicam ao solver ficam zerados. A lista tabu do
+// TabuCol e o contador de platô da têmpera não são guardados: a busca retomada
+// recomeça com eles vazios.
+//
+// Arquivo (inteiros na ordem de bytes nativa):
+//   char magic[8] = "GCOLCKP", uint32 version, uint32 tamanho do nome, nome do solver
+//   int32 vértices, int64 arestas, uint64 hash do CSR (GraphFingerprint do grafo dos solvers)
+//   int32 neighborhood, int32 k, int32 bestK, int64 iteration
+//   double temperature, double initialTemperature, double coolingRate, uint64 rng[4]
+//   bloco colors e bloco bestColors, no formato de ResultWriter::encodeColoring
+struct SolverCheckpoint
+{
+    std::string solver;        // "SA" ou "TabuCol"
+    GraphFingerprint graph;    // grafo em que foi tirado
+    int neighborhood = 0;      // vizinhança da têmpera
+    int k = 0;                 // TabuCol: k da busca em andamento; têmpera: cores da coloração inicial
+    int bestK = 0;             // TabuCol: menor k legal até aqui
+    long long iteration = 0;   // iterações já feitas
+    double temperature = 0;
+    double initialTemperature = 0;
+    double coolingRate = 0;
+    uint64_t rngState[4] = {};
+    std::vector<int> colors;     // solução corrente
+    std::vector<int> bestColors; // melhor solução
+
+    // Grava num arquivo temporário e o renomeia: um checkpoint nunca fica pela metade.
+    static void save(const std::string &path, const SolverCheckpoint &checkpoint)
+    {
+        std::string data(MAGIC, sizeof(MAGIC));
+        append(data, VERSION);
+        append(data, static_cast<uint32_t>(checkpoint.solver.size()));
+        data += checkpoint.solver;
+        append(data, checkpoint.graph.numVertices);
+        append(data, checkpoint.graph.numEdges);
+        append(data, checkpoint.graph.csrHash);
+        append(data, static_cast<int32_t>(checkpoint.neighborhood));
+        append(data, static_cast<int32_t>(checkpoint.k));
+        append(data, static_cast<int32_t>(checkpoint.bestK));
+        append(data, static_cast<int64_t>(checkpoint.iteration));
+        append(data, checkpoint.temperature);
+        append(data, checkpoint.initialTemperature);
+        append(data, checkpoint.coolingRate);
+        for (uint64_t word : checkpoint.rngState)
+            append(data, word);
+        data += ResultWriter::encodeColoring(checkpoint.colors);
+        data += ResultWriter::encodeColoring(checkpoint.bestColors);
+
+        std::string temporary = path + ".tmp";
+        {
+            std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+            if (!out.write(data.data(), static_cast<std::streamsize>(data.size())))
+                throw std::runtime_error(temporary + ": não foi possível gravar o checkpoint");
+        }
+        if (!GraphCache::replaceFile(temporary, path))
+            throw std::runtime_error(path + ": não foi possível substituir o checkpoint");
+    }
+
+    static SolverCheckpoint load(const std::string &path)
+    {
+        std::ifstream in(path, std::ios::binary);
+        char magic[sizeof(MAGIC)];
+        if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0)
+            throw std::runtime_error(path + ": não é um checkpoint");
+
+        SolverCheckpoint checkpoint;
+        uint32_t version = 0;
+        uint32_t nameLength = 0;
+        read(in, version, path);
+        if (version != VERSION)
+            throw std::runtime_error(path + ": versão de checkpoint " + std::to_string(version) + " não suportada");
+        read(in, nameLength, path);
+        checkpoint.solver.resize(nameLength);
+        if (!in.read(&checkpoint.solver[0], nameLength))
+            throw std::runtime_error(path + ": checkpoint truncado");
+        read(in, checkpoint.graph.numVertices, path);
+        read(in, checkpoint.graph.numEdges, path);
+        read(in, checkpoint.graph.csrHash, path);
+
+        int32_t neighborhood, k, bestK;
+        int64_t iteration;
+        read(in, neighborhood, path);
+        read(in, k, path);
+        read(in, bestK, path);
+        read(in, iteration, path);
+        read(in, checkpoint.temperature, path);
+        read(in, checkpoint.initialTemperature, path);
+        read(in, checkpoint.coolingRate, path);
+        for (uint64_t &word : checkpoint.rngState)
+            read(in, word, path);
+        checkpoint.neighborhood = neighborhood;
+        checkpoint.k = k;
+        checkpoint.bestK = bestK;
+        checkpoint.iteration = iteration;
+        checkpoint.colors = ResultWriter::decodeColoring(in, path);
+        checkpoint.bestColors = ResultWriter::decodeColoring(in, path);
+        return checkpoint;
+    }
+
+    static bool isCheckpoint(const std::string &path)
+    {
+        std::ifstream in(path, std::ios::binary);
+        char magic[sizeof(MAGIC)];
+        return in.read(magic, sizeof(magic)) && std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+    }
+
+    // Carrega o checkpoint de `path` se ele for desta busca (solver e vizinhança) e
+    // deste grafo. Um arquivo de outra busca, de outro grafo (outra --ordering, por
+    // exemplo), de outra versão ou ilegível é ignorado com um aviso em `out`: a busca
+    // recomeça do zero e o sobrescreve no próximo checkpoint. O mesmo vale para cores
+    // fora de 0..max(k, bestK) + colorSlack - 1 (colorSlack: classes além de k que a
+    // busca mantém), que estourariam as tabelas montadas a partir de k.
+    static bool loadMatching(const std::string &path, const std::string &solver, int neighborhood, int colorSlack,
+                             const GraphFingerprint &graph, SolverCheckpoint &checkpoint, std::ostream &out)
+    {
+        if (path.empty() || !isCheckpoint(path))
+            return false;
+
+        std::string mismatch;
+        try
+        {
+            checkpoint = load(path);
+            if (checkpoint.solver != solver || checkpoint.neighborhood != neighborhood)
+                mismatch = path + ": é de outra busca";
+            else if (checkpoint.graph != graph || static_cast<int>(checkpoint.colors.size()) != graph.numVertices ||
+                     static_cast<int>(checkpoint.bestColors.size()) != graph.numVertices)
+                mismatch = path + ": é de outro grafo";
+            else if (checkpoint.k < 0 || checkpoint.bestK < 0 ||
+                     !colorsWithin(checkpoint.colors, std::max(checkpoint.k, checkpoint.bestK) + colorSlack) ||
+                     !colorsWithin(checkpoint.bestColors, std::max(checkpoint.k, checkpoint.bestK) + colorSlack))
+                mismatch = path + ": cores fora da paleta de k = " + std::to_string(checkpoint.k);
+        }
+        catch (const std::exception &e)
+        {
+            mismatch = e.what();
+        }
+        if (mismatch.empty())
+            return true;
+        out << "Aviso: checkpoint ignorado (" << mismatch << ")\n";
+        return false;
+    }
+
+private:
+    static bool colorsWithin(const std::vector<int> &colors, long long numColors)
+    {
+        return std::all_of(colors.begin(), colors.end(), [numColors](int c)
+                           { return c >= 0 && c < numColors; });
+    }
+
+    static constexpr char MAGIC[8] = {'G', 'C', 'O', 'L', 'C', 'K', 'P', '\0'};
+    static constexpr uint32_t VERSION = 2;
+
+    template <typename T>
+    static void append(std::string &data, const T &value)
+    {
+        data.append(reinterpret_cast<const char *>(&value), sizeof(value));
+    }
+
+    template <typename T>
+    static void read(std::istream &in, T &value, const std::string &path)
+    {
+        if (!in.read(reinterpret_cast<char *>(&value), sizeof(value)))
+            throw std::runtime_error(path + ": checkpoint truncado");
+    }
+};
+
+// Decide quando gravar: due() é chamado a cada iteração, mas só lê o relógio a
+// cada CHECK_STRIDE chamadas e fica verdadeiro uma vez a cada intervalSeconds.
+class Checkpointer
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr int CHECK_STRIDE = 4096;
+
+    Checkpointer(std::string path, double intervalSeconds)
+        : filePath(std::move(path)), interval(std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(intervalSeconds))),
+          lastWrite(Clock::now()) {}
+
+    const std::string &path() const { return filePath; }
+
+    bool due()
+    {
+        if (--countdown > 0)
+            return false;
+        countdown = CHECK_STRIDE;
+        Clock::time_point now = Clock::now();
+        if (now - lastWrite < interval)
+            return false;
+        lastWrite = now;
+        return true;
+    }
+
+    void write(const SolverCheckpoint &checkpoint) const
+    {
+        SolverCheckpoint::save(filePath, checkpoint);
+    }
+
+    // A busca terminou normalmente: o checkpoint não serve mais.
+    void discard() const
+    {
+        std::remove(filePath.c_str());
+    }
+
+private:
+    std::string filePath;
+    Clock::duration interval;
+    Clock::time_point lastWrite;
+    int countdown = CHECK_STRIDE;
+};
+
+// Colorações de partida (warm start) e colorações salvas entre execuções.
+namespace ColoringFile
+{
+    // Aceita um arquivo de cores do ResultWriter (primeiro bloco), um checkpoint
+    // (melhor solução) ou texto com uma cor por vértice na ordem dos vértices
+    // (linhas começadas por '#' ou 'c' são comentários).
+    inline std::vector<int> read(const std::string &path)
+    {
+        if (ResultWriter::isColorsFile(path))
+            return ResultWriter::readColoring(path, 16);
+
+        if (SolverCheckpoint::isCheckpoint(path))
+            return SolverCheckpoint::load(path).bestColors;
+
+        std::ifstream in(path);
+        if (!in.is_open())
+            throw std::runtime_error(path + ": não foi possível abrir a coloração");
+
+        std::vector<int> colors;
+        std::string line;
+        while (std::getline(in, line))
+        {
+            if (line.empty() || line[0] == '#' || line[0] == 'c')
+                continue;
+            std::istringstream values(line);
+            int color;
+            while (values >> color)
+            {
+                if (color < 0)
+                    throw std::runtime_error(path + ": cor negativa");
+                colors.push_back(color);
+            }
+        }
+        return colors;
+    }
+
+    inline void write(const std::string &path, const std::vector<int> &colors)
+    {
+        std::ofstream out(path, std::ios::trunc);
+        if (!out.is_open())
+            throw std::runtime_error(path + ": não foi possível gravar a coloração");
+        out << "# " << colors.size() << " vértices\n";
+        for (int color : colors)
+            out << color << "\n";
+    }
+
+    // Renumera as cores usadas para 0..k-1, preservando a ordem entre elas.
+    inline std::vector<int> compact(const std::vector<int> &colors)
+    {
+        std::vector<int> used(colors);
+        std::sort(used.begin(), used.end());
+        used.erase(std::unique(used.begin(), used.end()), used.end());
+
+        std::vector<int> compacted(colors.size());
+        for (size_t v = 0; v < colors.size(); ++v)
+            compacted[v] = static_cast<int>(std::lower_bound(used.begin(), used.end(), colors[v]) - used.begin());
+        return compacted;
+    }
+}
+
+#endif // CHECKPOINT_H
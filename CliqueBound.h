@@ -0,0 +1,302 @@
+#ifndef CLIQUE_BOUND_H
+#define CLIQUE_BOUND_H
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include "Graph.h"
+#include "BitsetGraph.h"
+
+// Limite inferior do número cromático pelo tamanho de um clique: toda coloração
+// legal usa ao menos |clique| cores. O clique vem de uma busca gulosa seguida de
+// branch-and-bound limitado em nós; se a busca terminar antes do limite o clique
+// é máximo (exact), senão fica o maior encontrado, que continua sendo um limite válido.
+struct CliqueResult
+{
+    std::vector<int> clique;
+    bool exact = false;
+    long long nodes = 0;
+
+    int size() const { return static_cast<int>(clique.size()); }
+};
+
+namespace CliqueBound
+{
+    const long long DEFAULT_NODE_LIMIT = 200000;
+
+    // Maior n para o qual a variante em bitsets monta sua matriz (n² / 8 bytes).
+    const int MAX_BITSET_VERTICES = 8192;
+
+    // Para cada um dos `starts` vértices de maior grau, cresce um clique pelos
+    // vizinhos em ordem decrescente de grau.
+    inline std::vector<int> greedy(const Graph &graph, int starts = 32)
+    {
+        const std::vector<int> &order = graph.getDegreeOrder();
+        std::vector<int> rank(graph.getNumVertices());
+        for (int i = 0; i < static_cast<int>(order.size()); ++i)
+            rank[order[i]] = i;
+
+        std::vector<int> best;
+        std::vector<int> clique;
+        std::vector<int> candidates;
+        for (int s = 0; s < std::min(starts, static_cast<int>(order.size())); ++s)
+        {
+            int start = order[s];
+            if (graph.degree(start) + 1 <= static_cast<int>(best.size()))
+                break;
+
+            candidates.assign(graph.neighborsOf(start).begin(), graph.neighborsOf(start).end());
+            std::sort(candidates.begin(), candidates.end(), [&](int a, int b)
+                      { return rank[a] < rank[b]; });
+
+            clique.assign(1, start);
+            for (int c : candidates)
+            {
+                bool adjacentToAll = true;
+                for (int member : clique)
+                {
+                    if (!graph.hasEdge(member, c))
+                    {
+                        adjacentToAll = false;
+                        break;
+                    }
+                }
+                if (adjacentToAll)
+                    clique.push_back(c);
+            }
+            if (clique.size() > best.size())
+                best = clique;
+        }
+        return best;
+    }
+
+    // Branch-and-bound sobre listas (grafos esparsos): cada clique é enumerado a partir
+    // do seu vértice de menor posição na ordem de grau; poda por |atual| + |candidatos|.
+    class ListSearch
+    {
+    public:
+        ListSearch(const Graph &graph, long long nodeLimit, std::vector<int> initial)
+            : graph(graph), nodeLimit(nodeLimit), best(std::move(initial)), rank(graph.getNumVertices()) {}
+
+        CliqueResult run()
+        {
+            const std::vector<int> &order = graph.getDegreeOrder();
+            for (int i = 0; i < static_cast<int>(order.size()); ++i)
+                rank[order[i]] = i;
+
+            std::vector<int> candidates;
+            for (int v : order)
+            {
+                if (graph.degree(v) + 1 <= static_cast<int>(best.size()) || aborted)
+                    continue;
+
+                candidates.clear();
+                for (int u : graph.neighborsOf(v))
+                {
+                    if (rank[u] > rank[v])
+                        candidates.push_back(u);
+                }
+                std::sort(candidates.begin(), candidates.end(), [&](int a, int b)
+                          { return rank[a] < rank[b]; });
+
+                current.assign(1, v);
+                expand(candidates);
+            }
+
+            CliqueResult result;
+            result.clique = best;
+            result.exact = !aborted;
+            result.nodes = nodes;
+            return result;
+        }
+
+    private:
+        const Graph &graph;
+        long long nodeLimit;
+        std::vector<int> best;
+        std::vector<int> rank;
+        std::vector<int> current;
+        long long nodes = 0;
+        bool aborted = false;
+
+        void expand(const std::vector<int> &candidates)
+        {
+            if (++nodes > nodeLimit)
+            {
+                aborted = true;
+                return;
+            }
+            if (candidates.empty())
+            {
+                if (current.size() > best.size())
+                    best = current;
+                return;
+            }
+
+            std::vector<int> next;
+            for (size_t i = 0; i < candidates.size() && !aborted; ++i)
+            {
+                if (current.size() + (candidates.size() - i) <= best.size())
+                    return;
+
+                int v = candidates[i];
+                next.clear();
+                for (size_t j = i + 1; j < candidates.size(); ++j)
+                {
+                    if (graph.hasEdge(v, candidates[j]))
+                        next.push_back(candidates[j]);
+                }
+
+                current.push_back(v);
+                expand(next);
+                current.pop_back();
+            }
+        }
+    };
+
+    // Branch-and-bound em bitsets (grafos densos), no estilo MCQ/BBMC: os vértices são
+    // renumerados em ordem decrescente de grau, o conjunto de candidatos é um bitset e o
+    // limite de cada ramo vem de uma coloração gulosa dos candidatos (um clique não
+    // pode ter mais vértices do que cores nessa coloração).
+    class BitsetSearch
+    {
+    public:
+        BitsetSearch(const Graph &graph, long long nodeLimit, std::vector<int> initial)
+            : nodeLimit(nodeLimit), n(graph.getNumVertices()), words((n + 63) / 64), best(std::move(initial))
+        {
+            order = graph.getDegreeOrder();
+            std::vector<int> local(n);
+            for (int i = 0; i < n; ++i)
+                local[order[i]] = i;
+
+            adjacency.assign(static_cast<size_t>(n) * words, 0);
+            for (int i = 0; i < n; ++i)
+            {
+                uint64_t *row = &adjacency[static_cast<size_t>(i) * words];
+                for (int u : graph.neighborsOf(order[i]))
+                    row[local[u] >> 6] |= uint64_t(1) << (local[u] & 63);
+            }
+        }
+
+        CliqueResult run()
+        {
+            std::vector<uint64_t> candidates(words, 0);
+            for (int i = 0; i < n; ++i)
+                candidates[i >> 6] |= uint64_t(1) << (i & 63);
+            expand(candidates);
+
+            CliqueResult result;
+            result.clique = best;
+            result.exact = !aborted;
+            result.nodes = nodes;
+            return result;
+        }
+
+    private:
+        long long nodeLimit;
+        int n;
+        int words;
+        std::vector<int> best;
+        std::vector<int> order; // id local -> vértice do grafo
+        std::vector<uint64_t> adjacency;
+        std::vector<int> current;
+        long long nodes = 0;
+        bool aborted = false;
+
+        const uint64_t *row(int v) const { return &adjacency[static_cast<size_t>(v) * words]; }
+
+        static bool empty(const std::vector<uint64_t> &set)
+        {
+            for (uint64_t word : set)
+            {
+                if (word)
+                    return false;
+            }
+            return true;
+        }
+
+        void expand(std::vector<uint64_t> &candidates)
+        {
+            if (++nodes > nodeLimit)
+            {
+                aborted = true;
+                return;
+            }
+
+            // Coloração gulosa dos candidatos: vertices[i] recebe a cor colorOf[i], crescente
+            std::vector<int> vertices;
+            std::vector<int> colorOf;
+            std::vector<uint64_t> uncolored = candidates;
+            std::vector<uint64_t> available(words);
+            int color = 0;
+            while (!empty(uncolored))
+            {
+                ++color;
+                available = uncolored;
+                for (int w = 0; w < words; ++w)
+                {
+                    while (available[w])
+                    {
+                        int v = w * 64 + BitsetKernels::countTrailingZeros64(available[w]);
+                        available[w] &= available[w] - 1;
+                        uncolored[w] &= ~(uint64_t(1) << (v & 63));
+                        const uint64_t *neighbors = row(v);
+                        for (int x = w; x < words; ++x)
+                            available[x] &= ~neighbors[x];
+                        vertices.push_back(v);
+                        colorOf.push_back(color);
+                    }
+                }
+            }
+
+            std::vector<uint64_t> next(words);
+            for (int i = static_cast<int>(vertices.size()) - 1; i >= 0 && !aborted; --i)
+            {
+                if (static_cast<int>(current.size()) + colorOf[i] <= static_cast<int>(best.size()))
+                    return;
+
+                int v = vertices[i];
+                const uint64_t *neighbors = row(v);
+                for (int w = 0; w < words; ++w)
+                    next[w] = candidates[w] & neighbors[w];
+
+                current.push_back(v);
+                if (empty(next))
+                {
+                    if (current.size() > best.size())
+                    {
+                        best.clear();
+                        for (int u : current)
+                            best.push_back(order[u]);
+                    }
+                }
+                else
+                {
+                    expand(next);
+                }
+                current.pop_back();
+                candidates[v >> 6] &= ~(uint64_t(1) << (v & 63));
+            }
+        }
+    };
+
+    inline CliqueResult branchAndBound(const Graph &graph, long long nodeLimit = DEFAULT_NODE_LIMIT)
+    {
+        return ListSearch(graph, nodeLimit, greedy(graph)).run();
+    }
+
+    inline CliqueResult branchAndBoundBitset(const Graph &graph, long long nodeLimit = DEFAULT_NODE_LIMIT)
+    {
+        return BitsetSearch(graph, nodeLimit, greedy(graph)).run();
+    }
+
+    // Escolhe a variante: bitsets quando o grafo é denso (ver DenseAdjacency) e cabe.
+    inline CliqueResult lowerBound(const Graph &graph, long long nodeLimit = DEFAULT_NODE_LIMIT)
+    {
+        if (graph.getDenseAdjacency() != nullptr && graph.getNumVertices() <= MAX_BITSET_VERTICES)
+            return branchAndBoundBitset(graph, nodeLimit);
+        return branchAndBound(graph, nodeLimit);
+    }
+}
+
+#endif // CLIQUE_BOUND_H
@@ -0,0 +1,181 @@
+#ifndef COLORING_VERIFIER_H
+#define COLORING_VERIFIER_H
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <cstdint>
+#include "Graph.h"
+#include "BitsetGraph.h"
+#include "WorkStealingPool.h"
+
+// Resultado da verificação de uma coloração completa.
+struct ColoringReport
+{
+    long long conflicts = 0; // arestas com as duas pontas da mesma cor
+    int uncolored = 0;       // vértices com cor negativa
+    int maxColor = -1;
+    std::vector<int> usedColors;                        // cores usadas, em ordem crescente
+    std::vector<std::pair<int, int>> conflictingEdges; // (u, v) com u < v
+
+    int numColors() const { return static_cast<int>(usedColors.size()); }
+    int colorSpan() const { return maxColor + 1; } // custo dos solvers: maior cor + 1
+    bool isValid() const { return conflicts == 0 && uncolored == 0; }
+};
+
+// Avaliação completa de colorações sobre um arranjo contíguo de arestas (u < v),
+// montado uma vez a partir do CSR: cada aresta é vista uma vez, e não duas como
+// nas listas de adjacência. As arestas são divididas em blocos de CHUNK_EDGES,
+// verificados em paralelo quando há um pool; com AVX2 na compilação as cores das
+// duas pontas de 8 arestas são lidas por gather e comparadas de uma vez.
+class ColoringVerifier
+{
+public:
+    static constexpr size_t CHUNK_EDGES = 1 << 18;
+
+    explicit ColoringVerifier(const Graph &graph) : n(graph.getNumVertices())
+    {
+        size_t numEdges = graph.getNeighbors().size() / 2;
+        first.reserve(numEdges);
+        second.reserve(numEdges);
+        for (int v = 0; v < n; ++v)
+        {
+            auto range = graph.neighborsOf(v);
+            for (auto it = std::upper_bound(range.begin(), range.end(), v); it != range.end(); ++it)
+            {
+                first.push_back(v);
+                second.push_back(*it);
+            }
+        }
+    }
+
+    int getNumVertices() const { return n; }
+    size_t getNumEdges() const { return first.size(); }
+
+    ColoringReport verify(const std::vector<int> &colors, WorkStealingPool *pool = nullptr) const
+    {
+        const size_t numEdges = first.size();
+        const size_t chunks = std::max<size_t>(1, (numEdges + CHUNK_EDGES - 1) / CHUNK_EDGES);
+        std::vector<Partial> partials(chunks);
+        auto runChunk = [&](size_t chunk)
+        {
+            Partial &partial = partials[chunk];
+            scanEdges(colors, numEdges * chunk / chunks, numEdges * (chunk + 1) / chunks, partial);
+            scanVertices(colors, static_cast<int>(n * chunk / chunks), static_cast<int>(n * (chunk + 1) / chunks), partial);
+        };
+
+        if (pool != nullptr && chunks > 1)
+        {
+            WorkStealingPool::TaskGroup group;
+            for (size_t chunk = 0; chunk < chunks; ++chunk)
+                pool->submit([&runChunk, chunk]
+                             { runChunk(chunk); },
+                             group);
+            pool->wait(group);
+        }
+        else
+        {
+            for (size_t chunk = 0; chunk < chunks; ++chunk)
+                runChunk(chunk);
+        }
+
+        ColoringReport report;
+        std::vector<uint64_t> colorBits;
+        for (const Partial &partial : partials)
+        {
+            report.conflicts += partial.conflicts;
+            report.uncolored += partial.uncolored;
+            report.maxColor = std::max(report.maxColor, partial.maxColor);
+            report.conflictingEdges.insert(report.conflictingEdges.end(), partial.edges.begin(), partial.edges.end());
+            if (partial.colorBits.size() > colorBits.size())
+                colorBits.resize(partial.colorBits.size(), 0);
+            for (size_t word = 0; word < partial.colorBits.size(); ++word)
+                colorBits[word] |= partial.colorBits[word];
+        }
+
+        for (size_t word = 0; word < colorBits.size(); ++word)
+        {
+            for (uint64_t bits = colorBits[word]; bits; bits &= bits - 1)
+                report.usedColors.push_back(static_cast<int>(word * 64 + BitsetKernels::countTrailingZeros64(bits)));
+        }
+        return report;
+    }
+
+private:
+    int n;
+    std::vector<int> first;  // ponta menor de cada aresta, em ordem crescente
+    std::vector<int> second; // ponta maior
+
+    struct Partial
+    {
+        long long conflicts = 0;
+        int uncolored = 0;
+        int maxColor = -1;
+        std::vector<uint64_t> colorBits;
+        std::vector<std::pair<int, int>> edges;
+    };
+
+    // Arestas verificadas por bloco: quase toda coloração avaliada tem poucos conflitos,
+    // então o bloco é só contado (sem desvio) e percorrido de novo apenas se tiver algum.
+    static constexpr size_t SCAN_BLOCK = 256;
+
+    int countEqual(const int *colorData, size_t begin, size_t end) const
+    {
+        size_t i = begin;
+        int same = 0;
+#ifdef __AVX2__
+        __m256i total = _mm256_setzero_si256();
+        for (; i + 8 <= end; i += 8)
+        {
+            __m256i u = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first.data() + i));
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(second.data() + i));
+            // cmpeq dá -1 por aresta em conflito
+            total = _mm256_sub_epi32(total, _mm256_cmpeq_epi32(_mm256_i32gather_epi32(colorData, u, 4), _mm256_i32gather_epi32(colorData, v, 4)));
+        }
+        alignas(32) int lanes[8];
+        _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), total);
+        for (int lane : lanes)
+            same += lane;
+#endif
+        for (; i < end; ++i)
+            same += colorData[first[i]] == colorData[second[i]];
+        return same;
+    }
+
+    void scanEdges(const std::vector<int> &colors, size_t begin, size_t end, Partial &partial) const
+    {
+        const int *colorData = colors.data();
+        for (size_t block = begin; block < end; block += SCAN_BLOCK)
+        {
+            size_t blockEnd = std::min(block + SCAN_BLOCK, end);
+            if (countEqual(colorData, block, blockEnd) == 0)
+                continue;
+            for (size_t i = block; i < blockEnd; ++i)
+            {
+                if (colorData[first[i]] == colorData[second[i]])
+                    partial.edges.emplace_back(first[i], second[i]);
+            }
+        }
+        partial.conflicts = static_cast<long long>(partial.edges.size());
+    }
+
+    void scanVertices(const std::vector<int> &colors, int begin, int end, Partial &partial) const
+    {
+        for (int v = begin; v < end; ++v)
+        {
+            partial.maxColor = std::max(partial.maxColor, colors[v]);
+            partial.uncolored += colors[v] < 0;
+        }
+        if (partial.maxColor < 0)
+            return;
+
+        partial.colorBits.assign(static_cast<size_t>(partial.maxColor) / 64 + 1, 0);
+        for (int v = begin; v < end; ++v)
+        {
+            if (colors[v] >= 0)
+                partial.colorBits[colors[v] / 64] |= uint64_t(1) << (colors[v] % 64);
+        }
+    }
+};
+
+#endif // COLORING_VERIFIER_H
@@ -0,0 +1,213 @@
+#ifndef CONFLICT_TABLE_H
+#define CONFLICT_TABLE_H
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include "Graph.h"
+#include "BitsetGraph.h"
+
+// Tabela incremental de conflitos: para cada vértice v e cor c guarda quantos
+// vizinhos de v têm a cor c. Recolorir um vértice custa O(deg(v)) e o delta de
+// colisões de um movimento, assim como o custo (maior cor + 1), é lido em O(1).
+//
+// Em grafos densos (Graph::getDenseAdjacency) pode usar o backend de bitsets:
+// cada cor guarda o bitset dos seus vértices, recolorir custa O(1) e a contagem
+// vira popcount(linha(v) AND classe(c)), em O(n / 64). Vale a pena quando se
+// consultam poucas cores por movimento (têmpera simulada); quem varre todas as
+// cores de cada vértice (TabuCol, busca local) deve pedir Backend::Table.
+//
+// Os contadores da tabela são uint16_t (um contador nunca passa do grau do
+// vértice): a linha de um vértice ocupa metade das linhas de cache. Só quando
+// algum grau passa de 65535 a tabela usa int. As cores em si continuam int (aqui e
+// nos solvers): o vetor de cores tem n posições, contra n x k da tabela, e -1 marca
+// vértice sem cor; estreitá-lo quase não muda as linhas de cache tocadas numa
+// varredura de conflitos.
+class ConflictTable
+{
+public:
+    enum class Backend
+    {
+        Auto,  // Bitsets se o grafo tiver matriz densa, tabela caso contrário
+        Table, // Tabela n x k
+        Bitset // Classes de cor em bitsets (sem matriz densa, cai para a tabela)
+    };
+
+    ConflictTable() = default;
+
+    void build(const Graph &g, const std::vector<int> &initialColors, int colorCapacity, Backend backend = Backend::Auto)
+    {
+        graph = &g;
+        n = static_cast<int>(initialColors.size());
+        numColors = colorCapacity;
+        colors = initialColors;
+
+        dense = backend == Backend::Table ? nullptr : g.getDenseAdjacency();
+        classSize.assign(numColors, 0);
+        totalCollisions = 0;
+        maxColor = -1;
+
+        if (dense != nullptr)
+        {
+            table.clear();
+            words = dense->wordsPerRow();
+            classBits.assign(static_cast<size_t>(numColors) * words, 0);
+            for (int v = 0; v < n; ++v)
+                setClassBit(v, colors[v]);
+        }
+        else
+        {
+            classBits.clear();
+            int maxDegree = 0;
+            for (int v = 0; v < n; ++v)
+                maxDegree = std::max(maxDegree, g.degree(v));
+            wide = maxDegree > UINT16_MAX;
+            table.clear();
+            wideTable.clear();
+            if (wide)
+                wideTable.assign(static_cast<size_t>(n) * numColors, 0);
+            else
+                table.assign(static_cast<size_t>(n) * numColors, 0);
+        }
+
+        for (int v = 0; v < n; ++v)
+        {
+            ++classSize[colors[v]];
+            maxColor = std::max(maxColor, colors[v]);
+            if (dense != nullptr)
+            {
+                totalCollisions += neighborsWithColor(v, colors[v]);
+                continue;
+            }
+            for (int u : g.neighborsOf(v))
+            {
+                if (wide)
+                    ++wideTable[index(v, colors[u])];
+                else
+                    ++table[index(v, colors[u])];
+                if (colors[u] == colors[v])
+                    ++totalCollisions;
+            }
+        }
+        totalCollisions /= 2;
+    }
+
+    bool usesBitsets() const { return dense != nullptr; }
+    int colorCapacity() const { return numColors; }
+    int color(int v) const { return colors[v]; }
+    const std::vector<int> &getColors() const { return colors; }
+
+    // Número de vizinhos de v que usam a cor c.
+    int neighborsWithColor(int v, int c) const
+    {
+        if (dense != nullptr)
+            return BitsetKernels::andPopcount(dense->row(v), classRow(c), words);
+        return wide ? wideTable[index(v, c)] : table[index(v, c)];
+    }
+
+    bool canColor(int v, int c) const
+    {
+        if (dense != nullptr)
+            return !BitsetKernels::intersects(dense->row(v), classRow(c), words);
+        return neighborsWithColor(v, c) == 0;
+    }
+
+    int collisions() const { return totalCollisions; }
+
+    // Quantos vértices usam a cor c.
+    int colorClassSize(int c) const { return classSize[c]; }
+
+    int cost() const { return maxColor + 1; }
+
+    int collisionDelta(int v, int c) const
+    {
+        return neighborsWithColor(v, c) - neighborsWithColor(v, colors[v]);
+    }
+
+    // Custo (maior cor + 1) caso v passe a ter a cor c. Só percorre as classes
+    // quando v é o único vértice da maior cor, o que é raro e amortizado.
+    int costAfterRecolor(int v, int c) const
+    {
+        if (c >= maxColor)
+            return c + 1;
+        if (colors[v] != maxColor || classSize[maxColor] > 1)
+            return maxColor + 1;
+
+        int top = maxColor - 1;
+        while (top > c && classSize[top] == 0)
+            --top;
+        return top + 1;
+    }
+
+    void recolor(int v, int c)
+    {
+        int old = colors[v];
+        if (old == c)
+            return;
+
+        totalCollisions += collisionDelta(v, c);
+        if (dense != nullptr)
+        {
+            clearClassBit(v, old);
+            setClassBit(v, c);
+        }
+        else if (wide)
+        {
+            moveNeighborCounts(wideTable, v, old, c);
+        }
+        else
+        {
+            moveNeighborCounts(table, v, old, c);
+        }
+
+        colors[v] = c;
+        --classSize[old];
+        ++classSize[c];
+
+        if (c > maxColor)
+            maxColor = c;
+        while (maxColor > 0 && classSize[maxColor] == 0)
+            --maxColor;
+    }
+
+private:
+    const Graph *graph = nullptr;
+    const DenseAdjacency *dense = nullptr;
+    int n = 0;
+    int numColors = 0;
+    int words = 0;
+    int totalCollisions = 0;
+    int maxColor = -1;
+    bool wide = false;
+    std::vector<uint16_t> table;
+    std::vector<int> wideTable; // só com grau acima de 65535
+    std::vector<uint64_t> classBits;
+    std::vector<int> classSize;
+    std::vector<int> colors;
+
+    size_t index(int v, int c) const { return static_cast<size_t>(v) * numColors + c; }
+
+    template <typename Count>
+    void moveNeighborCounts(std::vector<Count> &counts, int v, int oldColor, int newColor)
+    {
+        for (int u : graph->neighborsOf(v))
+        {
+            --counts[index(u, oldColor)];
+            ++counts[index(u, newColor)];
+        }
+    }
+
+    const uint64_t *classRow(int c) const { return &classBits[static_cast<size_t>(c) * words]; }
+
+    void setClassBit(int v, int c)
+    {
+        classBits[static_cast<size_t>(c) * words + (v >> 6)] |= uint64_t(1) << (v & 63);
+    }
+
+    void clearClassBit(int v, int c)
+    {
+        classBits[static_cast<size_t>(c) * words + (v >> 6)] &= ~(uint64_t(1) << (v & 63));
+    }
+};
+
+#endif // CONFLICT_TABLE_H
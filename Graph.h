@@ -0,0 +1,147 @@
+#ifndef GRAPH_H
+#define GRAPH_H
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <memory>
+#include "BitsetGraph.h"
+#include "GraphComponents.h"
+
+// Grafo imutável em formato CSR (compressed sparse row): os vizinhos de v ficam
+// contíguos em neighbors[offsets[v] .. offsets[v + 1]), ordenados, sem
+// repetições e sem laços. Os vértices são indexados a partir de 0.
+class Graph
+{
+public:
+    class NeighborRange
+    {
+    public:
+        NeighborRange(const int *first, const int *last) : first(first), last(last) {}
+
+        const int *begin() const { return first; }
+        const int *end() const { return last; }
+        int size() const { return static_cast<int>(last - first); }
+        int operator[](int i) const { return first[i]; }
+
+    private:
+        const int *first;
+        const int *last;
+    };
+
+    Graph() : offsets(1, 0) {}
+
+    // Arestas com extremos fora de [0, numVertices) são ignoradas.
+    Graph(int numVertices, const std::vector<std::pair<int, int>> &edges) : n(numVertices), offsets(numVertices + 1, 0)
+    {
+        for (const auto &edge : edges)
+        {
+            if (isValidEdge(edge.first, edge.second))
+            {
+                ++offsets[edge.first + 1];
+                ++offsets[edge.second + 1];
+            }
+        }
+        for (int v = 0; v < n; ++v)
+            offsets[v + 1] += offsets[v];
+
+        neighbors.resize(offsets[n]);
+        std::vector<int> next(offsets.begin(), offsets.end() - 1);
+        for (const auto &edge : edges)
+        {
+            if (isValidEdge(edge.first, edge.second))
+            {
+                neighbors[next[edge.first]++] = edge.second;
+                neighbors[next[edge.second]++] = edge.first;
+            }
+        }
+
+        // Ordena cada lista e remove arestas repetidas, compactando o vetor
+        int write = 0;
+        for (int v = 0; v < n; ++v)
+        {
+            auto first = neighbors.begin() + offsets[v];
+            auto last = neighbors.begin() + offsets[v + 1];
+            std::sort(first, last);
+            auto unique = std::unique(first, last);
+
+            offsets[v] = write;
+            write = static_cast<int>(std::copy(first, unique, neighbors.begin() + write) - neighbors.begin());
+        }
+        offsets[n] = write;
+        neighbors.resize(write);
+        neighbors.shrink_to_fit();
+
+        buildDegreeOrder();
+        buildBackends();
+    }
+
+    // Monta o grafo a partir de arrays CSR já normalizados (por exemplo, vindos do cache binário).
+    Graph(int numVertices, std::vector<int> csrOffsets, std::vector<int> csrNeighbors, std::vector<int> order)
+        : n(numVertices), offsets(std::move(csrOffsets)), neighbors(std::move(csrNeighbors)), degreeOrder(std::move(order))
+    {
+        if (static_cast<int>(degreeOrder.size()) != n)
+            buildDegreeOrder();
+        buildBackends();
+    }
+
+    int getNumVertices() const { return n; }
+    int getNumEdges() const { return static_cast<int>(neighbors.size() / 2); }
+    int degree(int v) const { return offsets[v + 1] - offsets[v]; }
+
+    NeighborRange neighborsOf(int v) const
+    {
+        return NeighborRange(neighbors.data() + offsets[v], neighbors.data() + offsets[v + 1]);
+    }
+
+    bool hasEdge(int u, int v) const
+    {
+        if (dense)
+            return dense->hasEdge(u, v);
+        auto range = neighborsOf(u);
+        return std::binary_search(range.begin(), range.end(), v);
+    }
+
+    const std::vector<int> &getOffsets() const { return offsets; }
+    const std::vector<int> &getNeighbors() const { return neighbors; }
+
+    // Vértices em ordem decrescente de grau (empates pelo menor índice).
+    const std::vector<int> &getDegreeOrder() const { return degreeOrder; }
+
+    // Componentes conexas, calculadas uma vez na construção.
+    const GraphComponents &getComponents() const { return components; }
+
+    // Matriz de bitsets, presente só quando o grafo é denso o bastante (DenseAdjacency::preferredFor).
+    const DenseAdjacency *getDenseAdjacency() const { return dense.get(); }
+
+private:
+    int n = 0;
+    std::vector<int> offsets;
+    std::vector<int> neighbors;
+    std::vector<int> degreeOrder;
+    GraphComponents components;
+    std::shared_ptr<const DenseAdjacency> dense;
+
+    void buildBackends()
+    {
+        components = GraphComponents(n, offsets, neighbors);
+        if (DenseAdjacency::preferredFor(n, getNumEdges()))
+            dense = std::make_shared<const DenseAdjacency>(n, offsets, neighbors);
+    }
+
+    void buildDegreeOrder()
+    {
+        degreeOrder.resize(n);
+        for (int v = 0; v < n; ++v)
+            degreeOrder[v] = v;
+        std::stable_sort(degreeOrder.begin(), degreeOrder.end(), [&](int a, int b)
+                         { return degree(a) > degree(b); });
+    }
+
+    bool isValidEdge(int u, int v) const
+    {
+        return u != v && u >= 0 && u < n && v >= 0 && v < n;
+    }
+};
+
+#endif // GRAPH_H
@@ -0,0 +1,188 @@
+#ifndef GRAPH_CACHE_H
+#define GRAPH_CACHE_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "Graph.h"
+#include "MappedFile.h"
+
+// Cache binário de instâncias já pré-processadas. Layout (inteiros na ordem
+// de bytes nativa da máquina):
+//
+//   Header                                   (48 bytes)
+//   int32 offsets[numVertices + 1]
+//   int32 neighbors[numNeighbors]
+//   int32 degreeOrder[numVertices]
+//
+// O hash e o tamanho do arquivo de origem ficam no cabeçalho; o cache só é
+// usado enquanto os dois baterem com o arquivo texto atual.
+namespace GraphCache
+{
+    const char MAGIC[8] = {'G', 'C', 'O', 'L', 'C', 'S', 'R', '\0'};
+    const uint32_t VERSION = 1;
+
+    struct Header
+    {
+        char magic[8];
+        uint32_t version;
+        int32_t numVertices;
+        uint64_t numNeighbors;
+        uint64_t sourceSize;
+        uint64_t sourceHash;
+        uint64_t reserved;
+    };
+
+    inline std::string cachePathFor(const std::string &sourcePath)
+    {
+        return sourcePath + ".csr";
+    }
+
+    // FNV-1a de 64 bits sobre o conteúdo do arquivo.
+    inline uint64_t hashBytes(const char *data, size_t size)
+    {
+        uint64_t hash = 14695981039346656037ULL;
+        for (size_t i = 0; i < size; ++i)
+        {
+            hash ^= static_cast<unsigned char>(data[i]);
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    // Substitui `target` por `temporary`. No POSIX o rename já troca o arquivo de uma
+    // vez; no Windows ele falha se o destino existir, e aí o destino é apagado antes
+    // de tentar de novo. Se não der certo, o temporário é apagado.
+    inline bool replaceFile(const std::string &temporary, const std::string &target)
+    {
+        std::error_code error;
+        std::filesystem::rename(temporary, target, error);
+        if (error)
+        {
+            error.clear();
+            std::filesystem::remove(target, error);
+            error.clear();
+            std::filesystem::rename(temporary, target, error);
+        }
+        if (error)
+        {
+            std::error_code ignored;
+            std::filesystem::remove(temporary, ignored);
+            return false;
+        }
+        return true;
+    }
+
+    inline bool write(const std::string &cachePath, const Graph &graph, uint64_t sourceSize, uint64_t sourceHash)
+    {
+        Header header = {};
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = VERSION;
+        header.numVertices = graph.getNumVertices();
+        header.numNeighbors = graph.getNeighbors().size();
+        header.sourceSize = sourceSize;
+        header.sourceHash = sourceHash;
+
+        // Escreve em um arquivo temporário e renomeia, para nunca deixar um cache pela metade
+        std::string tmpPath = cachePath + ".tmp";
+        {
+            std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+            if (!out.is_open())
+                return false;
+
+            auto writeInts = [&](const std::vector<int> &values)
+            {
+                out.write(reinterpret_cast<const char *>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(int32_t)));
+            };
+
+            out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+            writeInts(graph.getOffsets());
+            writeInts(graph.getNeighbors());
+            writeInts(graph.getDegreeOrder());
+            if (!out.good())
+            {
+                out.close();
+                std::remove(tmpPath.c_str());
+                return false;
+            }
+        }
+
+        return replaceFile(tmpPath, cachePath);
+    }
+
+    // Confere o CSR lido antes de entregá-lo aos solvers, que indexam sem checar: offsets
+    // de 0 a numNeighbors sem decrescer; em cada lista, vizinhos em [0, n), crescentes e
+    // sem laços; degreeOrder uma permutação de 0..n-1. Um cache corrompido falha aqui.
+    inline bool isValidCsr(const std::vector<int> &offsets, const std::vector<int> &neighbors, const std::vector<int> &degreeOrder,
+                           uint64_t numNeighbors)
+    {
+        const int n = static_cast<int>(offsets.size()) - 1;
+        if (offsets.front() != 0 || static_cast<uint64_t>(offsets.back()) != numNeighbors)
+            return false;
+        for (int v = 0; v < n; ++v)
+        {
+            if (offsets[v] > offsets[v + 1])
+                return false;
+            int previous = -1;
+            for (int i = offsets[v]; i < offsets[v + 1]; ++i)
+            {
+                if (neighbors[i] <= previous || neighbors[i] >= n || neighbors[i] == v)
+                    return false;
+                previous = neighbors[i];
+            }
+        }
+
+        std::vector<char> seen(n, 0);
+        for (int v : degreeOrder)
+        {
+            if (v < 0 || v >= n || seen[v])
+                return false;
+            seen[v] = 1;
+        }
+        return true;
+    }
+
+    // Lê o cache se ele existir, for válido e corresponder a (sourceSize, sourceHash);
+    // senão devolve false e quem chama lê a instância de novo.
+    inline bool load(const std::string &cachePath, uint64_t sourceSize, uint64_t sourceHash, Graph &graph)
+    {
+        MappedFile file(cachePath);
+        if (!file.isOpen() || file.size() < sizeof(Header))
+            return false;
+
+        Header header;
+        std::memcpy(&header, file.data(), sizeof(header));
+        if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION ||
+            header.sourceSize != sourceSize || header.sourceHash != sourceHash || header.numVertices < 0)
+            return false;
+
+        size_t n = static_cast<size_t>(header.numVertices);
+        size_t expected = sizeof(Header) + (2 * n + 1 + header.numNeighbors) * sizeof(int32_t);
+        if (file.size() != expected)
+            return false;
+
+        const char *cursor = file.data() + sizeof(Header);
+        auto readInts = [&](size_t count)
+        {
+            std::vector<int> values(count);
+            std::memcpy(values.data(), cursor, count * sizeof(int32_t));
+            cursor += count * sizeof(int32_t);
+            return values;
+        };
+
+        std::vector<int> offsets = readInts(n + 1);
+        std::vector<int> neighbors = readInts(header.numNeighbors);
+        std::vector<int> degreeOrder = readInts(n);
+        if (!isValidCsr(offsets, neighbors, degreeOrder, header.numNeighbors))
+            return false;
+
+        graph = Graph(header.numVertices, std::move(offsets), std::move(neighbors), std::move(degreeOrder));
+        return true;
+    }
+}
+
+#endif // GRAPH_CACHE_H
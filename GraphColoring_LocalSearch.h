@@ -3,246 +3,481 @@
 
 #include <iostream>
 #include <vector>
+#include <string>
 #include <algorithm>
 #include <chrono>
-#include <functional>
+#include <memory>
+#include "Graph.h"
+#include "InitialColoring.h"
+#include "Random.h"
+#include "ConflictTable.h"
+#include "BucketQueue.h"
+#include "WorkStealingPool.h"
+#include "SearchBudget.h"
+#include "NeighborhoodPolicies.h"
+#include "Checkpoint.h"
+#include "ColoringVerifier.h"
+#include "KempeChain.h"
 
 class GraphColoring_LocalSearch
 {
 public:
-    GraphColoring_LocalSearch(int n) : n(n), numDistinctColors(0), executionTime(0), adjList(n), colors(n, -1) {}
+    GraphColoring_LocalSearch(const Graph &graph, std::ostream &out = std::cout)
+        : n(graph.getNumVertices()), numDistinctColors(0), executionTime(0), graph(graph), colors(n, -1), out(out) {}
 
-    void addEdge(int u, int v)
+    void setInitialColoring(InitialColoringStrategy strategy)
     {
-        if (u >= 0 && u < n && v >= 0 && v < n)
-        {
-            adjList[u].push_back(v);
-            adjList[v].push_back(u);
-        }
+        initialStrategy = strategy;
     }
 
     void initialColoring()
     {
-        std::fill(colors.begin(), colors.end(), -1);
-
-        std::vector<int> vertices(n);
-        for (int i = 0; i < n; ++i)
-            vertices[i] = i;
-        std::sort(vertices.begin(), vertices.end(), [&](int a, int b)
-                  { return adjList[a].size() > adjList[b].size(); });
-
-        for (int v : vertices)
+        if (!warmStart.empty())
         {
-            std::vector<bool> forbiddenColors(n, false);
-
-            for (int u : adjList[v])
-            {
-                if (colors[u] != -1)
-                {
-                    forbiddenColors[colors[u]] = true;
-                }
-            }
-
-            int color = 0;
-            while (color < n && forbiddenColors[color])
-            {
-                color++;
-            }
-
-            colors[v] = color;
+            colors = warmStart;
+            numDistinctColors = *std::max_element(colors.begin(), colors.end()) + 1;
+            return;
         }
+        numDistinctColors = InitialColoring::color(initialStrategy, graph, colors);
+    }
 
-        numDistinctColors = *std::max_element(colors.begin(), colors.end()) + 1;
+    // Coloração de partida (warm start) no lugar da estratégia inicial; as cores são
+    // renumeradas para 0..k-1.
+    void setInitialSolution(const std::vector<int> &solution)
+    {
+        if (static_cast<int>(solution.size()) != n)
+            throw std::runtime_error("Coloração de partida com " + std::to_string(solution.size()) + " vértices; o grafo tem " + std::to_string(n));
+        warmStart = ColoringFile::compact(solution);
     }
 
     void initialColoring_v2()
     {
-        srand(static_cast<unsigned>(time(nullptr)));
-
         for (int i = 0; i < n; ++i)
         {
-            colors[i] = rand() % 100 + 1; // Valores aleatórios de 1 a 100
+            colors[i] = rng.nextInt(100) + 1; // Valores aleatórios de 1 a 100
         }
 
         numDistinctColors = *std::max_element(colors.begin(), colors.end()) + 1;
     }
 
+    // Tempo limite, alvo de cores e parada sem conflitos (ver SearchBudget). Em
+    // localSearch o prazo vale para as quatro buscas juntas; o alvo, para cada uma.
+    void setBudget(const SearchBudget &searchBudget)
+    {
+        budget = searchBudget;
+    }
+
+    SearchBudget::StopReason getStopReason() const { return stopReason; }
+
     void localSearch()
     {
+        auto start = std::chrono::steady_clock::now();
+        Deadline deadline(budget);
+        activeDeadline = &deadline;
         initialColoring();
         std::vector<int> initialColors = colors;
-        int initialCollisions = calculateCollisions();
+        int initialCollisions = static_cast<int>(verifier().verify(colors, pool).conflicts);
+
+        results.clear();
+        runNeighborhood<1, FirstImprovement>("1-first", "Primeira melhoria (Vizinho 1)", initialCollisions);
+        runNeighborhood<1, BestImprovement>("1-best", "Melhor melhoria (Vizinho 1)", initialCollisions);
+        runNeighborhood<2, FirstImprovement>("2-first", "Primeira melhoria (Vizinho 2)", initialCollisions);
+        runNeighborhood<2, BestImprovement>("2-best", "Melhor melhoria (Vizinho 2)", initialCollisions);
+        runNeighborhood<3, FirstImprovement>("3-first", "Primeira melhoria (Vizinho 3)", initialCollisions);
+        runNeighborhood<3, BestImprovement>("3-best", "Melhor melhoria (Vizinho 3)", initialCollisions);
+
+        activeDeadline = nullptr;
+        stopReason = deadline.stopReason();
+        executionTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+        out << "Tempo de execução: " << executionTime << " ms";
+        if (stopReason != SearchBudget::StopReason::None)
+            out << " (" << SearchBudget::describe(stopReason) << ")";
+        out << "\n";
+    }
+
+    // Resultado de cada uma das seis buscas da última chamada de localSearch.
+    struct NeighborhoodResult
+    {
+        std::string name; // "1-first", "1-best", "2-first", "2-best", "3-first", "3-best"
+        std::vector<int> colors;
+        double wallMs = 0;
+        long long iterations = 0;
+        ColoringReport verification; // verificação completa de `colors`
+    };
 
-        // Primeira melhoria para vizinhança 1
-        auto resultFirstImprovement1 = neighborhood1(true);
-        saveResult("Primeira melhoria (Vizinho 1)", resultFirstImprovement1, initialCollisions);
+    const std::vector<NeighborhoodResult> &getResults() const { return results; }
 
-        // Melhor melhoria para vizinhança 1
-        auto resultBestImprovement1 = neighborhood1(false);
-        saveResult("Melhor melhoria (Vizinho 1)", resultBestImprovement1, initialCollisions);
+    // Duração da última chamada de localSearch, em milissegundos.
+    long long getExecutionTime() const { return executionTime; }
 
-        // Primeira melhoria para vizinhança 2
-        auto resultFirstImprovement2 = neighborhood2(true);
-        saveResult("Primeira melhoria (Vizinho 2)", resultFirstImprovement2, initialCollisions);
+    // Movimentos avaliados desde a construção (componentes na vizinhança 1, vértices
+    // na vizinhança 2, cadeias na vizinhança 3), acumulados entre chamadas.
+    long long getIterations() const { return iterations; }
 
-        // Melhor melhoria para vizinhança 2
-        auto resultBestImprovement2 = neighborhood2(false);
-        saveResult("Melhor melhoria (Vizinho 2)", resultBestImprovement2, initialCollisions);
+    // Avaliações independentes (vizinhança 1) passam a rodar em paralelo neste pool.
+    void setPool(WorkStealingPool &workerPool)
+    {
+        pool = &workerPool;
     }
 
+    // Vizinhança 1: recolore toda a componente conexa de um vértice com as cores que
+    // ela ainda não usa. Cada componente é avaliada uma vez; como não há arestas entre
+    // componentes, o delta de colisões de uma só depende dela, e as avaliações rodam
+    // em paralelo quando há um pool.
     std::vector<int> neighborhood1(bool firstImprovement)
     {
-        std::vector<int> bestColors = colors;
-        int bestCollisions = calculateCollisions();
+        return firstImprovement ? neighborhood1<FirstImprovement>() : neighborhood1<BestImprovement>();
+    }
 
-        for (int startVertex = 0; startVertex < n; ++startVertex)
-        {
-            std::vector<int> cluster;
-            std::vector<bool> visited(n, false);
+    template <typename Improvement>
+    std::vector<int> neighborhood1()
+    {
+        Deadline localDeadline(budget);
+        Deadline &deadline = activeDeadline != nullptr ? *activeDeadline : localDeadline;
+        if (deadline.check())
+            return colors;
+
+        const GraphComponents &components = graph.getComponents();
+        const int numComponents = components.count();
+        std::vector<int> tempColors = colors;
+        std::vector<int> delta(numComponents, 0);
 
-            std::function<void(int)> dfs = [&](int v)
+        auto evaluateRange = [&](int first, int last)
+        {
+            std::vector<char> colorsUsed(numDistinctColors + 1);
+            for (int component = first; component < last; ++component)
             {
-                visited[v] = true;
-                cluster.push_back(v);
-                for (int u : adjList[v])
+                auto cluster = components.verticesOf(component);
+
+                std::fill(colorsUsed.begin(), colorsUsed.end(), 0);
+                for (int v : cluster)
                 {
-                    if (!visited[u])
+                    if (colors[v] != -1)
                     {
-                        dfs(u);
+                        colorsUsed[colors[v]] = 1;
                     }
                 }
-            };
 
-            dfs(startVertex);
+                int newColor = 0;
+                for (int v : cluster)
+                {
+                    while (newColor < numDistinctColors && colorsUsed[newColor])
+                    {
+                        ++newColor;
+                    }
+                    tempColors[v] = newColor;
+                    colorsUsed[newColor] = 1;
+                }
 
-            std::vector<bool> colorsUsed(numDistinctColors, false);
-            for (int v : cluster)
-            {
-                if (colors[v] != -1)
+                int before = 0;
+                int after = 0;
+                for (int v : cluster)
                 {
-                    colorsUsed[colors[v]] = true;
+                    for (int u : graph.neighborsOf(v))
+                    {
+                        before += colors[u] == colors[v];
+                        after += tempColors[u] == tempColors[v];
+                    }
                 }
+                delta[component] = (after - before) / 2;
             }
+        };
 
-            std::vector<int> tempColors = colors;
-            int newColor = 0;
-            for (int v : cluster)
+        if (pool != nullptr && numComponents > 1)
+        {
+            int chunks = std::min(numComponents, static_cast<int>(pool->size()) * 4);
+            WorkStealingPool::TaskGroup group;
+            for (int chunk = 0; chunk < chunks; ++chunk)
             {
-                while (newColor < numDistinctColors && colorsUsed[newColor])
-                {
-                    ++newColor;
-                }
-                tempColors[v] = newColor;
-                colorsUsed[newColor] = true;
+                int first = static_cast<int>(static_cast<long long>(numComponents) * chunk / chunks);
+                int last = static_cast<int>(static_cast<long long>(numComponents) * (chunk + 1) / chunks);
+                pool->submit([&evaluateRange, first, last]
+                             { evaluateRange(first, last); },
+                             group);
             }
+            pool->wait(group);
+        }
+        else
+        {
+            evaluateRange(0, numComponents);
+        }
+        iterations += numComponents;
 
-            int newCollisions = calculateCollisions(tempColors);
-            if (newCollisions < bestCollisions)
+        // Componentes na ordem do menor vértice: mesma ordem de varredura de antes
+        int chosen = -1;
+        for (int component = 0; component < numComponents; ++component)
+        {
+            if (delta[component] < 0 && (chosen == -1 || delta[component] < delta[chosen]))
             {
-                bestColors = tempColors;
-                bestCollisions = newCollisions;
-                if (firstImprovement)
-                    return bestColors;
+                chosen = component;
+                if (Improvement::stopAtFirst)
+                    break;
             }
         }
 
+        std::vector<int> bestColors = colors;
+        if (chosen != -1)
+        {
+            for (int v : components.verticesOf(chosen))
+                bestColors[v] = tempColors[v];
+        }
         return bestColors;
     }
 
+    // Vizinhança 2: um vértice passa a usar uma cor menor já usada por outro vértice.
+    // Os movimentos são avaliados pelo delta da ConflictTable e aplicados até não
+    // haver melhora: na primeira melhoria, o primeiro movimento de melhora na ordem
+    // dos vértices; na melhor melhoria, o de menor delta, vindo de uma fila por baldes
+    // atualizada só para o vértice movido e seus vizinhos.
     std::vector<int> neighborhood2(bool firstImprovement)
     {
-        std::vector<int> bestColors = colors;
-        int bestCollisions = calculateCollisions();
+        return firstImprovement ? neighborhood2<FirstImprovement>() : neighborhood2<BestImprovement>();
+    }
+
+    template <typename Improvement>
+    std::vector<int> neighborhood2()
+    {
+        Deadline localDeadline(budget);
+        Deadline &deadline = activeDeadline != nullptr ? *activeDeadline : localDeadline;
 
-        for (int v1 = 0; v1 < n; ++v1)
+        ConflictTable table;
+        table.build(graph, colors, numDistinctColors, ConflictTable::Backend::Table);
+        if (deadline.targetReached(table.cost(), table.collisions()))
+            return table.getColors();
+
+        if constexpr (Improvement::stopAtFirst)
         {
-            for (int v2 = 0; v2 < n; ++v2)
+            int v = 0;
+            int verticesWithoutImprovement = 0;
+            while (verticesWithoutImprovement < n && !deadline.expired())
             {
-                if (colors[v1] != colors[v2])
+                int color = bestRecolor<Improvement>(table, v);
+                ++iterations;
+                if (color != -1)
+                {
+                    table.recolor(v, color);
+                    verticesWithoutImprovement = 0;
+                    if (deadline.targetReached(table.cost(), table.collisions()))
+                        break;
+                }
+                else
                 {
-                    int higherColorVertex = (colors[v1] > colors[v2]) ? v1 : v2;
-                    int lowerColorVertex = (higherColorVertex == v1) ? v2 : v1;
+                    ++verticesWithoutImprovement;
+                }
+                v = (v + 1) % n;
+            }
+            return table.getColors();
+        }
+        else
+        {
+            return bestImprovementRecolors(table, deadline);
+        }
+    }
 
-                    std::vector<int> tempColors = colors;
-                    tempColors[higherColorVertex] = tempColors[lowerColorVertex];
+    // Vizinhança 3: trocas em cadeias de Kempe para esvaziar a maior classe de cor.
+    // Para cada vértice v da maior cor m e cada cor b < m, a troca de K(v, m, b) muda
+    // o tamanho da classe m pela diferença entre os vértices de b e os de m na cadeia,
+    // contados na própria busca, sem aplicar a troca; colisões não mudam. Aplica-se a
+    // primeira cor que diminui a classe (primeira melhoria) ou a que mais a diminui
+    // (melhor melhoria); esvaziada a classe, o custo cai e a busca segue na nova maior.
+    std::vector<int> neighborhood3(bool firstImprovement)
+    {
+        return firstImprovement ? neighborhood3<FirstImprovement>() : neighborhood3<BestImprovement>();
+    }
+
+    template <typename Improvement>
+    std::vector<int> neighborhood3()
+    {
+        Deadline localDeadline(budget);
+        Deadline &deadline = activeDeadline != nullptr ? *activeDeadline : localDeadline;
+
+        ConflictTable table;
+        table.build(graph, colors, numDistinctColors, ConflictTable::Backend::Table);
+        kempe.reset(n);
+        std::vector<int> members;
+
+        bool improved = true;
+        while (improved && !deadline.targetReached(table.cost(), table.collisions()) && !deadline.expired())
+        {
+            improved = false;
+            int top = table.cost() - 1;
+            if (top <= 0)
+                break;
+
+            members.clear();
+            for (int v = 0; v < n; ++v)
+            {
+                if (table.color(v) == top)
+                    members.push_back(v);
+            }
+
+            for (int v : members)
+            {
+                // Uma troca anterior pode ter tirado v da classe
+                if (table.color(v) != top)
+                    continue;
 
-                    int newCollisions = calculateCollisions(tempColors);
-                    if (newCollisions < bestCollisions)
+                int bestColor = -1;
+                int bestDelta = 0;
+                for (int b = 0; b < top; ++b)
+                {
+                    kempe.extract(graph, table, v, b);
+                    ++iterations;
+                    int delta = kempe.classSizeAfterSwap(table, top) - table.colorClassSize(top);
+                    if (delta < bestDelta)
                     {
-                        bestColors = tempColors;
-                        bestCollisions = newCollisions;
-                        if (firstImprovement)
-                            return bestColors;
+                        bestDelta = delta;
+                        bestColor = b;
+                        if (Improvement::stopAtFirst)
+                            break;
                     }
                 }
+                if (bestColor == -1)
+                    continue;
+
+                if (kempe.getColorB() != bestColor)
+                    kempe.extract(graph, table, v, bestColor);
+                kempe.applySwap(table);
+                improved = true;
+                if (table.cost() - 1 != top || deadline.expired())
+                    break;
             }
         }
-
-        return bestColors;
+        return table.getColors();
     }
 
-    void saveResult(const std::string &description, const std::vector<int> &resultColors, int initialCollisions)
+    void saveResult(const std::string &description, const ColoringReport &verification, int initialCollisions)
     {
-        int finalCollisions = calculateCollisions(resultColors);
-        int colorCount = countDistinctColors(resultColors);
-        std::cout << description << ": " << colorCount << " cores diferentes, Colisões iniciais: " << initialCollisions << ", Colisões finais: " << finalCollisions << ".\n";
+        long long finalCollisions = verification.conflicts;
+        int colorCount = verification.colorSpan();
+        out << description << ": " << colorCount << " cores diferentes, Colisões iniciais: " << initialCollisions << ", Colisões finais: " << finalCollisions;
+        if (budget.getLowerBound() > 0 && finalCollisions == 0)
+            out << ", Gap: " << budget.gap(colorCount);
+        out << ".\n";
     }
 
 private:
     int n;
     int numDistinctColors;
     long long executionTime;
-    std::vector<std::vector<int>> adjList;
+    long long iterations = 0;
+    const Graph &graph;
     std::vector<int> colors;
+    std::ostream &out;
+    Xoshiro256 rng;
+    InitialColoringStrategy initialStrategy = InitialColoringStrategy::DSatur;
+    std::vector<int> warmStart; // vazio: coloração inicial pela estratégia
+    WorkStealingPool *pool = nullptr;
+    SearchBudget budget;
+    Deadline *activeDeadline = nullptr; // prazo de localSearch, compartilhado pelas vizinhanças
+    SearchBudget::StopReason stopReason = SearchBudget::StopReason::None;
+    std::vector<NeighborhoodResult> results;
+    std::unique_ptr<ColoringVerifier> coloringVerifier;
+    KempeChains kempe; // rascunho da vizinhança 3
+
+    template <int Neighborhood, typename Improvement>
+    void runNeighborhood(const char *name, const std::string &description, int initialCollisions)
+    {
+        NeighborhoodResult result;
+        result.name = name;
+        long long iterationsBefore = iterations;
+        auto start = std::chrono::steady_clock::now();
+        if constexpr (Neighborhood == 1)
+            result.colors = neighborhood1<Improvement>();
+        else if constexpr (Neighborhood == 2)
+            result.colors = neighborhood2<Improvement>();
+        else
+            result.colors = neighborhood3<Improvement>();
+        result.wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        result.iterations = iterations - iterationsBefore;
+
+        result.verification = verifier().verify(result.colors, pool);
+        saveResult(description, result.verification, initialCollisions);
+        results.push_back(std::move(result));
+    }
 
-    bool isColoringValid(const std::vector<int> &tempColors) const
+    // Melhor melhoria da vizinhança 2 sobre a fila por baldes.
+    std::vector<int> bestImprovementRecolors(ConflictTable &table, Deadline &deadline)
     {
+        int maxDegree = 0;
         for (int v = 0; v < n; ++v)
+            maxDegree = std::max(maxDegree, graph.degree(v));
+
+        BucketQueue queue;
+        queue.reset(n, -maxDegree, maxDegree);
+        std::vector<int> moveColor(n, -1);
+
+        auto refresh = [&](int v)
         {
-            for (int u : adjList[v])
-            {
-                if (tempColors[v] == tempColors[u])
-                    return false;
-            }
-        }
-        return true;
-    }
+            queue.remove(v);
+            moveColor[v] = bestRecolor<BestImprovement>(table, v);
+            ++iterations;
+            if (moveColor[v] != -1)
+                queue.insert(v, table.collisionDelta(v, moveColor[v]));
+        };
 
-    int calculateCollisions() const
-    {
-        int collisions = 0;
         for (int v = 0; v < n; ++v)
+            refresh(v);
+
+        while (!queue.empty() && queue.minKey() < 0 && !deadline.expired())
         {
-            for (int u : adjList[v])
+            int v = queue.top();
+            int oldColor = table.color(v);
+            table.recolor(v, moveColor[v]);
+            if (deadline.targetReached(table.cost(), table.collisions()))
+                break;
+
+            if (table.colorClassSize(oldColor) == 0)
             {
-                if (colors[v] == colors[u])
-                {
-                    ++collisions;
-                }
+                // A cor antiga deixou de existir: movimentos para ela ficaram inválidos
+                for (int u = 0; u < n; ++u)
+                    refresh(u);
+            }
+            else
+            {
+                refresh(v);
+                for (int u : graph.neighborsOf(v))
+                    refresh(u);
             }
         }
-        return collisions / 2;
+
+        return table.getColors();
     }
 
-    int calculateCollisions(const std::vector<int> &tempColors) const
+    // Melhor cor (menor delta) para v entre as cores menores que a sua e já usadas;
+    // na primeira melhoria devolve a primeira que reduz colisões. -1 se não houver movimento
+    // (ou, na primeira melhoria, nenhum que melhore).
+    template <typename Improvement>
+    int bestRecolor(const ConflictTable &table, int v) const
     {
-        int collisions = 0;
-        for (int v = 0; v < n; ++v)
+        int current = table.color(v);
+        int bestColor = -1;
+        int bestDelta = 0;
+        for (int c = 0; c < current; ++c)
         {
-            for (int u : adjList[v])
+            if (table.colorClassSize(c) == 0)
+                continue;
+
+            int delta = table.collisionDelta(v, c);
+            if constexpr (Improvement::stopAtFirst)
             {
-                if (tempColors[v] == tempColors[u])
-                {
-                    ++collisions;
-                }
+                if (delta < 0)
+                    return c;
+            }
+            else if (bestColor == -1 || delta < bestDelta)
+            {
+                bestColor = c;
+                bestDelta = delta;
             }
         }
-        return collisions / 2;
+        return bestColor;
     }
 
-    int countDistinctColors(const std::vector<int> &colors) const
+    const ColoringVerifier &verifier()
     {
-        return *std::max_element(colors.begin(), colors.end()) + 1;
+        if (!coloringVerifier)
+            coloringVerifier = std::make_unique<ColoringVerifier>(graph);
+        return *coloringVerifier;
     }
 };
 
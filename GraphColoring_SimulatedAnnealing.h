@@ -5,301 +5,466 @@
 #include <vector>
 #include <algorithm>
 #include <cmath>
-#include <cstdlib>
-#include <ctime>
-#include <functional>
+#include <cstdint>
+#include <memory>
+#include <atomic>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include "Graph.h"
+#include "InitialColoring.h"
+#include "ConflictTable.h"
+#include "Move.h"
+#include "NeighborhoodPolicies.h"
+#include "AnnealingSchedule.h"
+#include "Checkpoint.h"
+#include "ColoringVerifier.h"
+#include "Random.h"
+#include "SearchTelemetry.h"
+#include "SearchBudget.h"
+#include "WorkStealingPool.h"
 
 class GraphColoring_SimulatedAnnealing
 {
 public:
-    GraphColoring_SimulatedAnnealing(int n, double initialTemp, double coolingRate, int maxIterations)
-        : n(n), initialTemp(initialTemp), coolingRate(coolingRate), maxIterations(maxIterations),
-          numDistinctColors(0), adjList(n), colors(n, -1), bestTemp(initialTemp), bestCoolingRate(coolingRate), bestColors(n) {}
-
-    void addEdge(int u, int v)
+    GraphColoring_SimulatedAnnealing(const Graph &graph, double initialTemp, double coolingRate, int maxIterations, std::ostream &out = std::cout)
+        : n(graph.getNumVertices()), numDistinctColors(0), bestTemp(initialTemp), bestCoolingRate(coolingRate), bestColors(n),
+          graph(graph), colors(n, -1), out(out)
     {
-        if (u >= 0 && u < n && v >= 0 && v < n)
-        {
-            adjList[u].push_back(v);
-            adjList[v].push_back(u);
-        }
+        parameters.initialTemp = initialTemp;
+        parameters.coolingRate = coolingRate;
+        parameters.maxIterations = maxIterations;
     }
 
-    void initialColoring()
+    // Troca todos os parâmetros de uma vez, inclusive o resfriamento adaptativo (ver AnnealingSchedule.h).
+    void setParameters(const AnnealingParameters &annealingParameters)
     {
-        std::fill(colors.begin(), colors.end(), -1);
-
-        std::vector<int> vertices(n);
-        for (int i = 0; i < n; ++i)
-            vertices[i] = i;
-        std::sort(vertices.begin(), vertices.end(), [&](int a, int b)
-                  { return adjList[a].size() > adjList[b].size(); });
-
-        for (int v : vertices)
-        {
-            std::vector<bool> forbiddenColors(n, false);
-
-            for (int u : adjList[v])
-            {
-                if (colors[u] != -1)
-                {
-                    forbiddenColors[colors[u]] = true;
-                }
-            }
+        parameters = annealingParameters;
+    }
 
-            int color = 0;
-            while (color < n && forbiddenColors[color])
-            {
-                color++;
-            }
+    const AnnealingParameters &getParameters() const { return parameters; }
 
-            colors[v] = color;
-        }
+    // Temperatura inicial e taxa de resfriamento efetivamente usadas na execução que
+    // ficou (calibradas, no modo adaptativo), e quantas vezes ela reaqueceu.
+    double getInitialTemperature() const { return bestTemp; }
+    double getCoolingRate() const { return bestCoolingRate; }
+    int getReheats() const { return reheats; }
 
-        numDistinctColors = *std::max_element(colors.begin(), colors.end()) + 1;
+    void setInitialColoring(InitialColoringStrategy strategy)
+    {
+        initialStrategy = strategy;
     }
 
-    void initialColoring_v2()
+    void initialColoring()
     {
-        srand(static_cast<unsigned>(time(nullptr)));
-
-        for (int i = 0; i < n; ++i)
+        if (!warmStart.empty())
         {
-            colors[i] = rand() % 100 + 1; // Valores aleatórios de 1 a 100
+            colors = warmStart;
+            numDistinctColors = verifier().verify(colors).colorSpan();
+            return;
         }
-
-        numDistinctColors = *std::max_element(colors.begin(), colors.end()) + 1;
+        numDistinctColors = InitialColoring::color(initialStrategy, graph, colors);
     }
 
-    void simulatedAnnealing(int neighborhoodType)
+    // Reinicia o gerador da instância; com a mesma semente a execução é reprodutível.
+    void setSeed(uint64_t seed)
     {
-        initialColoring();
-        std::vector<int> bestColorsVec = colors;
-        int bestCost = numDistinctColors;
-        int initialCollisions = calculateCollisions();
-        int bestCollisions = initialCollisions;
+        rng.reseed(seed);
+    }
 
-        double temperature = initialTemp;
-        srand(static_cast<unsigned>(time(nullptr)));
+    // Exporta amostras da busca para sink a cada sampleInterval iterações (ver SearchTelemetry).
+    void setTelemetry(TelemetrySink *sink, const std::string &run, long long sampleInterval)
+    {
+        telemetry.attach(sink, run, sampleInterval);
+    }
 
-        for (int iter = 0; iter < maxIterations; ++iter)
-        {
-            std::vector<int> newColors;
+    const SearchTelemetry &getTelemetry() const { return telemetry; }
 
-            if (neighborhoodType == 1)
-            {
-                newColors = generateNeighbor1();
-            }
-            else if (neighborhoodType == 2)
-            {
-                newColors = generateNeighbor2();
-            }
-            else if (neighborhoodType == 3)
-            {
-                newColors = generateNeighbor3();
-            }
+    // Tempo limite, alvo de cores e parada sem conflitos (ver SearchBudget). Com tempo
+    // limite, maxIterations <= 0 deixa a busca correr até o prazo.
+    void setBudget(const SearchBudget &searchBudget)
+    {
+        budget = searchBudget;
+    }
 
-            int newCollisions = calculateCollisions(newColors);
-            int newCost = countDistinctColors(newColors);
+    SearchBudget::StopReason getStopReason() const { return stopReason; }
 
-            if ((newCost < bestCost) ||
-                (newCost == bestCost && newCollisions < bestCollisions) ||
-                acceptWorseSolution(bestCost, newCost, temperature))
-            {
-                colors = newColors;
-                bestCost = newCost;
-                bestCollisions = newCollisions;
-                bestColorsVec = colors;
-            }
-
-            temperature *= coolingRate;
+    void initialColoring_v2()
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            colors[i] = rng.nextInt(100) + 1; // Valores aleatórios de 1 a 100
         }
 
-        colors = bestColorsVec;
-        numDistinctColors = bestCost;
-        std::cout << "Colisões iniciais: " << initialCollisions << ", Colisões finais: " << bestCollisions << "\n";
+        numDistinctColors = *std::max_element(colors.begin(), colors.end()) + 1;
     }
 
-    void printColors() const
+    // Coloração de partida (warm start) no lugar da estratégia inicial; as cores são
+    // renumeradas para 0..k-1.
+    void setInitialSolution(const std::vector<int> &solution)
     {
-        int finalCollisions = calculateCollisions();
-        std::cout << "Número de cores diferentes usadas: " << numDistinctColors << "\n";
-        std::cout << "Colisões finais: " << finalCollisions << "\n";
+        if (static_cast<int>(solution.size()) != n)
+            throw std::runtime_error("Coloração de partida com " + std::to_string(solution.size()) + " vértices; o grafo tem " + std::to_string(n));
+        warmStart = ColoringFile::compact(solution);
     }
 
-private:
-    int n;
-    double initialTemp;
-    double coolingRate;
-    int maxIterations;
-    int numDistinctColors;
-    double bestTemp;
-    double bestCoolingRate;
-    int bestColors;
-    std::vector<std::vector<int>> adjList;
-    std::vector<int> colors;
-
-    bool canColor(int v, int color) const
+    // Grava o estado da busca em `path` a cada intervalSeconds (e ao parar por tempo);
+    // se o arquivo já existir, a busca continua dele. No multi-start cada cadeia usa
+    // path + ".cadeia<i>".
+    void setCheckpoint(const std::string &path, double intervalSeconds)
     {
-        for (int u : adjList[v])
-        {
-            if (colors[u] == color)
-                return false;
-        }
-        return true;
+        checkpointPath = path;
+        checkpointInterval = intervalSeconds;
     }
 
-    int countDistinctColors(const std::vector<int> &colors) const
+    // Regra de aceitação de pioras (ver NeighborhoodPolicies.h); Metropolis por padrão.
+    void setAcceptance(AcceptanceRule rule)
     {
-        return *std::max_element(colors.begin(), colors.end()) + 1;
+        acceptance = rule;
     }
 
-    bool acceptWorseSolution(int currentCost, int newCost, double temperature) const
+    // Escolhe, pelo id, a vizinhança de AnnealingNeighborhoods e roda o laço
+    // especializado para ela e para a regra de aceitação atual.
+    void simulatedAnnealing(int neighborhoodType)
     {
-        if (temperature <= 0)
-            return false;
-        double probability = std::exp((currentCost - newCost) / temperature);
-        return (static_cast<double>(rand()) / RAND_MAX) < probability;
+        requireNeighborhood(neighborhoodType);
+        dispatchPolicy(AnnealingNeighborhoods{}, neighborhoodType, [this](auto neighborhood)
+                       { dispatchPolicy(AcceptanceRules{}, acceptance, [this](auto rule)
+                                        { anneal<decltype(neighborhood), decltype(rule)>(); }); });
     }
 
-    int calculateCollisions() const
+    template <typename Neighborhood, typename Rule>
+    void anneal()
     {
-        int collisions = 0;
-        for (int v = 0; v < n; ++v)
+        static_assert(Neighborhood::id > 0 && Neighborhood::id < SearchTelemetry::MAX_NEIGHBORHOODS,
+                      "a telemetria não tem contadores para este id de vizinhança");
+        Deadline deadline(budget, peerStop);
+        SolverCheckpoint resumed;
+        bool resuming = loadCheckpoint(Neighborhood::id, resumed);
+        if (resuming)
         {
-            for (int u : adjList[v])
-            {
-                if (colors[v] == colors[u])
-                {
-                    ++collisions;
-                }
-            }
+            colors = resumed.colors;
+            numDistinctColors = resumed.k;
+            rng.setState(resumed.rngState);
         }
-        return collisions / 2;
-    }
-
-    int calculateCollisions(const std::vector<int> &newColors) const
-    {
-        int collisions = 0;
-        for (int v = 0; v < n; ++v)
+        else
         {
-            for (int u : adjList[v])
-            {
-                if (newColors[v] == newColors[u])
-                {
-                    ++collisions;
-                }
-            }
+            initialColoring();
         }
-        return collisions / 2;
-    }
+        conflicts.build(graph, colors, numDistinctColors + 1);
+        prepareScratch();
+        MoveContext context{graph, conflicts, rng, numDistinctColors, colorsUsed, kempe};
+
+        bestColorsVec = resuming ? resumed.bestColors : colors;
+        ColoringReport resumedBest = resuming ? verifier().verify(bestColorsVec) : ColoringReport();
+        int bestCost = resuming ? resumedBest.colorSpan() : conflicts.cost();
+        int initialCollisions = conflicts.collisions();
+        int bestCollisions = resuming ? static_cast<int>(resumedBest.conflicts) : initialCollisions;
+        int currentCost = conflicts.cost();
+        int currentCollisions = initialCollisions;
+
+        CoolingSchedule schedule(parameters);
+        if (resuming)
+            schedule.restore(resumed.initialTemperature, resumed.coolingRate);
+        else if (parameters.adaptive)
+            schedule.calibrate(sampleWorseningDeltas<Neighborhood>(context));
+        double temperature = resuming ? resumed.temperature : schedule.initialTemperature();
+        telemetry.start();
+
+        std::unique_ptr<Checkpointer> checkpointer;
+        if (!checkpointPath.empty())
+            checkpointer = std::make_unique<Checkpointer>(checkpointPath, checkpointInterval);
+        auto saveCheckpoint = [&](long long iteration)
+        {
+            SolverCheckpoint checkpoint;
+            checkpoint.solver = "SA";
+            checkpoint.graph = graphFingerprint();
+            checkpoint.neighborhood = Neighborhood::id;
+            checkpoint.k = numDistinctColors;
+            checkpoint.iteration = iteration;
+            checkpoint.temperature = temperature;
+            checkpoint.initialTemperature = schedule.initialTemperature();
+            checkpoint.coolingRate = schedule.coolingRate();
+            std::copy(rng.state(), rng.state() + 4, checkpoint.rngState);
+            checkpoint.colors = conflicts.getColors();
+            checkpoint.bestColors = bestColorsVec;
+            checkpointer->write(checkpoint);
+        };
 
-    std::vector<int> generateNeighbor1()
-    {
-        std::vector<int> newColors = colors;
+        const bool unbounded = parameters.maxIterations <= 0 && budget.hasTimeLimit();
+        bool done = deadline.targetReached(bestCost, bestCollisions);
+        long long iter = resuming ? resumed.iteration : 0;
+        if (resuming)
+            out << "Retomada do checkpoint na iteração " << iter << "\n";
+        for (; !done && (unbounded || iter < parameters.maxIterations) && !deadline.expired(); ++iter)
+        {
+            telemetry.beginIteration(iter);
+            bool improvedBest = false;
+            move.clear();
+            Neighborhood::generate(context, move);
 
-        std::vector<bool> visited(n, false);
-        std::vector<int> cluster;
+            telemetry.beginEvaluation(Neighborhood::id);
+            move.apply(conflicts);
+
+            // Garantir que o resultado do vizinho não é pior que o inicial
+            if (Neighborhood::keepsCollisions && conflicts.collisions() > currentCollisions)
+            {
+                move.revert(conflicts);
+            }
 
-        int startVertex = rand() % n;
+            int newCollisions = conflicts.collisions();
+            int newCost = conflicts.cost();
 
-        std::function<void(int)> dfs = [&](int v)
-        {
-            visited[v] = true;
-            cluster.push_back(v);
-            for (int u : adjList[v])
+            if ((newCost < currentCost) ||
+                (newCost == currentCost && newCollisions < currentCollisions) ||
+                Rule::accept(currentCost, newCost, temperature, rng))
             {
-                if (!visited[u])
+                currentCost = newCost;
+                currentCollisions = newCollisions;
+
+                // Só copia a solução quando ela de fato supera a melhor conhecida
+                if (currentCost < bestCost || (currentCost == bestCost && currentCollisions < bestCollisions))
                 {
-                    dfs(u);
+                    bestCost = currentCost;
+                    bestCollisions = currentCollisions;
+                    bestColorsVec = conflicts.getColors();
+                    improvedBest = true;
+                    done = deadline.targetReached(bestCost, bestCollisions);
                 }
+                telemetry.endIteration(true);
             }
-        };
+            else
+            {
+                move.revert(conflicts);
+                telemetry.endIteration(false);
+            }
+
+            temperature = schedule.next(temperature, improvedBest);
+            telemetry.sample(iter + 1, temperature, currentCost, currentCollisions, bestCost, bestCollisions);
+            if (checkpointer && checkpointer->due())
+                saveCheckpoint(iter + 1);
+        }
+        totalIterations += iter;
+        bestTemp = schedule.initialTemperature();
+        bestCoolingRate = schedule.coolingRate();
+        reheats = schedule.getReheats();
+        telemetry.finish(iter, temperature, currentCost, currentCollisions, bestCost, bestCollisions);
+
+        // Alvo (ou ótimo) atingido: as demais cadeias do multi-start podem parar
+        stopReason = deadline.stopReason();
+
+        // Interrompida por tempo ou pedido externo, a busca pode continuar depois; senão o checkpoint
+        // sai. Uma cadeia parada porque outra do multi-start atingiu o alvo também terminou.
+        bool stoppedByPeer = stopReason == SearchBudget::StopReason::Cancelled && !budget.stopRequested() &&
+                             peerStop != nullptr && peerStop->load(std::memory_order_relaxed);
+        if (checkpointer)
+        {
+            if ((stopReason == SearchBudget::StopReason::TimeLimit || stopReason == SearchBudget::StopReason::Cancelled) && !stoppedByPeer)
+                saveCheckpoint(iter);
+            else
+                checkpointer->discard();
+        }
 
-        dfs(startVertex);
+        if ((stopReason == SearchBudget::StopReason::Target || stopReason == SearchBudget::StopReason::Optimal) && peerStop != nullptr)
+            peerStop->store(true, std::memory_order_relaxed);
+
+        colors = bestColorsVec;
+        numDistinctColors = bestCost;
+        verification = verifier().verify(colors);
+        out << "Colisões iniciais: " << initialCollisions << ", Colisões finais: " << bestCollisions << "\n";
+        if (parameters.adaptive)
+            out << "Temperatura inicial calibrada: " << bestTemp << ", resfriamento: " << bestCoolingRate << ", reaquecimentos: " << reheats << "\n";
+        if (stopReason != SearchBudget::StopReason::None)
+            out << "Parada antecipada (" << SearchBudget::describe(stopReason) << ") após " << iter << " iterações\n";
+    }
 
-        std::vector<bool> colorsUsed(numDistinctColors, false);
-        for (int v : cluster)
+    // Várias cadeias independentes no pool, cada uma com semente derivada de
+    // masterSeed; fica a melhor coloração (menos cores, depois menos colisões).
+    void multiStartSimulatedAnnealing(int neighborhoodType, int numChains, uint64_t masterSeed, WorkStealingPool &pool)
+    {
+        requireNeighborhood(neighborhoodType);
+        numChains = std::max(1, numChains);
+        std::vector<std::ostringstream> chainOutputs(numChains);
+        std::vector<std::unique_ptr<GraphColoring_SimulatedAnnealing>> chains;
+        WorkStealingPool::TaskGroup group;
+        std::atomic<bool> chainStop{false};
+        verifier(); // montado uma vez e compartilhado pelas cadeias
+
+        // Um só fim de tempo para todas as cadeias, contado daqui e não de quando cada
+        // uma sai da fila do pool
+        SearchBudget chainBudget = budget;
+        chainBudget.startClock();
+
+        for (int i = 0; i < numChains; ++i)
         {
-            if (newColors[v] != -1)
+            chains.emplace_back(new GraphColoring_SimulatedAnnealing(graph, parameters.initialTemp, parameters.coolingRate, parameters.maxIterations, chainOutputs[i]));
+            chains[i]->setParameters(parameters);
+            chains[i]->setSeed(Xoshiro256::deriveSeed(masterSeed, static_cast<uint64_t>(i)));
+            chains[i]->setBudget(chainBudget);
+            chains[i]->setAcceptance(acceptance);
+            chains[i]->warmStart = warmStart;
+            if (!checkpointPath.empty())
             {
-                colorsUsed[newColors[v]] = true;
+                chains[i]->setCheckpoint(checkpointPath + ".cadeia" + std::to_string(i), checkpointInterval);
+                chains[i]->fingerprint = graphFingerprint();
+                chains[i]->fingerprinted = true;
             }
+            chains[i]->peerStop = &chainStop;
+            chains[i]->sharedVerifier = sharedVerifier;
+            chains[i]->setTelemetry(telemetry.getSink(), telemetry.getRun() + "/cadeia" + std::to_string(i), telemetry.getSampleInterval());
+
+            GraphColoring_SimulatedAnnealing *chain = chains[i].get();
+            pool.submit([chain, neighborhoodType]
+                        { chain->simulatedAnnealing(neighborhoodType); },
+                        group);
         }
+        pool.wait(group);
 
-        int newColor = 0;
-        for (int v : cluster)
+        // Alguma cadeia atingiu o alvo: o multi-start terminou, e nenhuma cadeia deve ser
+        // retomada, nem as que pararam por tempo ao mesmo tempo
+        if (chainStop.load(std::memory_order_relaxed))
         {
-            while (newColor < numDistinctColors && colorsUsed[newColor])
+            for (const auto &chain : chains)
             {
-                ++newColor;
+                if (!chain->checkpointPath.empty())
+                    Checkpointer(chain->checkpointPath, 0).discard();
             }
-            newColors[v] = newColor;
-            colorsUsed[newColor] = true;
         }
 
-        // Garantir que o resultado não é pior que o inicial
-        if (calculateCollisions(newColors) > calculateCollisions())
+        int best = 0;
+        long long bestCollisions = chains[0]->verification.conflicts;
+        for (int i = 1; i < numChains; ++i)
         {
-            return colors; // Retorna as cores originais se o novo estado for pior
+            long long collisions = chains[i]->verification.conflicts;
+            if (chains[i]->numDistinctColors < chains[best]->numDistinctColors ||
+                (chains[i]->numDistinctColors == chains[best]->numDistinctColors && collisions < bestCollisions))
+            {
+                best = i;
+                bestCollisions = collisions;
+            }
         }
 
-        return newColors;
+        colors = chains[best]->colors;
+        numDistinctColors = chains[best]->numDistinctColors;
+        verification = chains[best]->verification;
+        for (const auto &chain : chains)
+            totalIterations += chain->totalIterations;
+        telemetry = chains[best]->telemetry;
+        bestTemp = chains[best]->bestTemp;
+        bestCoolingRate = chains[best]->bestCoolingRate;
+        reheats = chains[best]->reheats;
+        stopReason = chains[best]->stopReason;
+        out << chainOutputs[best].str();
+        out << "Melhor de " << numChains << " cadeias: cadeia " << best << "\n";
     }
 
-    std::vector<int> generateNeighbor2()
+    void printColors() const
     {
-        std::vector<int> newColors = colors;
+        long long finalCollisions = verification.conflicts;
+        out << "Número de cores diferentes usadas: " << numDistinctColors << "\n";
+        out << "Colisões finais: " << finalCollisions << "\n";
+        if (budget.getLowerBound() > 0 && finalCollisions == 0)
+            out << "Gap para o limite inferior: " << budget.gap(numDistinctColors) << "\n";
+    }
 
-        int v1 = rand() % n;
-        int v2 = rand() % n;
+    const std::vector<int> &getColors() const { return colors; }
+    int getNumColors() const { return numDistinctColors; }
 
-        if (v1 != v2)
-        {
-            int higherColorVertex = (colors[v1] > colors[v2]) ? v1 : v2;
-            int lowerColorVertex = (higherColorVertex == v1) ? v2 : v1;
+    // Verificação completa da coloração final (conflitos, cores usadas, arestas em conflito).
+    const ColoringReport &getVerification() const { return verification; }
 
-            if (canColor(higherColorVertex, colors[lowerColorVertex]))
-            {
-                newColors[higherColorVertex] = colors[lowerColorVertex];
-            }
-        }
+    // Iterações executadas (somadas sobre as cadeias, no multi-start).
+    long long getIterations() const { return totalIterations; }
 
-        return newColors;
+private:
+    int n;
+    AnnealingParameters parameters;
+    int numDistinctColors;
+    double bestTemp;
+    double bestCoolingRate;
+    int reheats = 0;
+    int bestColors;
+    const Graph &graph;
+    std::vector<int> colors;
+    std::ostream &out;
+    Xoshiro256 rng;
+    InitialColoringStrategy initialStrategy = InitialColoringStrategy::DSatur;
+    ConflictTable conflicts;
+    Move move;
+    std::vector<int> bestColorsVec;
+    std::vector<char> colorsUsed; // Reaproveitado pelo vizinho 1
+    KempeChains kempe;            // e este pelo vizinho 4
+    AcceptanceRule acceptance = AcceptanceRule::Metropolis;
+    std::vector<int> warmStart; // vazio: coloração inicial pela estratégia
+    std::string checkpointPath;
+    double checkpointInterval = 0;
+    long long totalIterations = 0;
+    SearchTelemetry telemetry;
+    SearchBudget budget;
+    SearchBudget::StopReason stopReason = SearchBudget::StopReason::None;
+    std::atomic<bool> *peerStop = nullptr; // compartilhado pelas cadeias de um multi-start
+    mutable std::shared_ptr<const ColoringVerifier> sharedVerifier;
+    ColoringReport verification;
+    GraphFingerprint fingerprint;
+    bool fingerprinted = false;
+
+    // Carrega o checkpoint, se houver um desta vizinhança e deste grafo.
+    bool loadCheckpoint(int neighborhood, SolverCheckpoint &checkpoint)
+    {
+        if (checkpointPath.empty())
+            return false;
+        return SolverCheckpoint::loadMatching(checkpointPath, "SA", neighborhood, 1, graphFingerprint(), checkpoint, out);
     }
 
-    std::vector<int> generateNeighbor3()
+    // Identificação do grafo nos checkpoints; no multi-start, calculada pelo solver principal.
+    const GraphFingerprint &graphFingerprint()
     {
-        std::vector<int> newColors = colors;
-        if (rand() % 2 == 0)
+        if (!fingerprinted)
         {
-            int v = rand() % n;
-            for (int c = 0; c < numDistinctColors; ++c)
-            {
-                if (canColor(v, c))
-                {
-                    newColors[v] = c;
-                    break;
-                }
-            }
+            fingerprint = GraphFingerprint::of(graph);
+            fingerprinted = true;
         }
-        else
-        {
-            int v1 = rand() % n;
-            int v2 = rand() % n;
+        return fingerprint;
+    }
 
-            if (v1 != v2)
-            {
-                int higherColorVertex = (colors[v1] > colors[v2]) ? v1 : v2;
-                int lowerColorVertex = (higherColorVertex == v1) ? v2 : v1;
+    static void requireNeighborhood(int neighborhoodType)
+    {
+        if (!dispatchPolicy(AnnealingNeighborhoods{}, neighborhoodType, [](auto) {}))
+            throw std::runtime_error("Vizinhança desconhecida: " + std::to_string(neighborhoodType));
+    }
 
-                if (canColor(higherColorVertex, colors[lowerColorVertex]))
-                {
-                    newColors[higherColorVertex] = colors[lowerColorVertex];
-                }
-            }
+    // Pioras de custo de movimentos sorteados a partir da coloração atual, desfeitos em seguida.
+    template <typename Neighborhood>
+    std::vector<int> sampleWorseningDeltas(MoveContext &context)
+    {
+        std::vector<int> deltas;
+        int cost = conflicts.cost();
+        for (int s = 0; s < CoolingSchedule::CALIBRATION_SAMPLES; ++s)
+        {
+            move.clear();
+            Neighborhood::generate(context, move);
+            move.apply(conflicts);
+            if (conflicts.cost() > cost)
+                deltas.push_back(conflicts.cost() - cost);
+            move.revert(conflicts);
         }
-        return newColors;
+        return deltas;
+    }
+
+    void prepareScratch()
+    {
+        move.reserve(n);
+        bestColorsVec.reserve(n);
+        colorsUsed.assign(numDistinctColors + 1, 0);
+        kempe.reset(n);
+    }
+
+    // Montado na primeira verificação; no multi-start as cadeias usam o do solver principal.
+    const ColoringVerifier &verifier() const
+    {
+        if (!sharedVerifier)
+            sharedVerifier = std::make_shared<const ColoringVerifier>(graph);
+        return *sharedVerifier;
     }
 };
 
@@ -0,0 +1,416 @@
+#ifndef GRAPH_COLORING_TABUCOL_H
+#define GRAPH_COLORING_TABUCOL_H
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include "Graph.h"
+#include "InitialColoring.h"
+#include "ConflictTable.h"
+#include "Random.h"
+#include "SearchBudget.h"
+#include "Checkpoint.h"
+#include "ColoringVerifier.h"
+
+// TabuCol (Hertz e de Werra, com a tenure dinâmica de Galinier e Hao): para um
+// k fixo minimiza o número de arestas em conflito recolorindo vértices
+// conflitantes, com a tabela gamma (ConflictTable) dando o delta de cada
+// movimento em O(1). O laço externo reduz k a cada coloração legal encontrada.
+class GraphColoring_TabuCol
+{
+public:
+    GraphColoring_TabuCol(const Graph &graph, double timeLimitSeconds, long long maxIterations, std::ostream &out = std::cout)
+        : n(graph.getNumVertices()), graph(graph), timeLimitSeconds(timeLimitSeconds), maxIterations(maxIterations),
+          colors(n, 0), bestColors(n, 0), conflictPosition(n, -1), out(out)
+    {
+        budget.setTimeLimit(timeLimitSeconds);
+    }
+
+    void setSeed(uint64_t seed)
+    {
+        rng.reseed(seed);
+    }
+
+    // Tenure = tenureBase + rand(0, tenureRandom) + tenureAlpha * |vértices em conflito|
+    void setTenure(int base, int random, double alpha)
+    {
+        tenureBase = base;
+        tenureRandom = random;
+        tenureAlpha = alpha;
+    }
+
+    // Alvo de cores, parada sem conflitos e parada externa (ver SearchBudget). Sem
+    // tempo limite no orçamento, vale o do construtor.
+    void setBudget(const SearchBudget &searchBudget)
+    {
+        budget = searchBudget;
+        if (!budget.hasTimeLimit())
+            budget.setTimeLimit(timeLimitSeconds);
+    }
+
+    SearchBudget::StopReason getStopReason() const { return stopReason; }
+
+    void setInitialColoring(InitialColoringStrategy strategy)
+    {
+        initialStrategy = strategy;
+    }
+
+    void initialColoring()
+    {
+        if (!warmStart.empty())
+            colors = warmStart;
+        else
+            InitialColoring::color(initialStrategy, graph, colors);
+    }
+
+    // Coloração de partida (warm start) no lugar da estratégia inicial; as cores são
+    // renumeradas para 0..k-1. Se tiver conflitos, a busca começa tentando torná-la
+    // legal com as mesmas k cores.
+    void setInitialSolution(const std::vector<int> &solution)
+    {
+        if (static_cast<int>(solution.size()) != n)
+            throw std::runtime_error("Coloração de partida com " + std::to_string(solution.size()) + " vértices; o grafo tem " + std::to_string(n));
+        warmStart = ColoringFile::compact(solution);
+    }
+
+    // Grava k, a coloração em busca e a melhor legal em `path` a cada intervalSeconds
+    // (e ao parar por tempo); se o arquivo já existir, a busca continua dele.
+    void setCheckpoint(const std::string &path, double intervalSeconds)
+    {
+        checkpointPath = path;
+        checkpointInterval = intervalSeconds;
+    }
+
+    void tabuCol()
+    {
+        deadline = std::make_unique<Deadline>(budget);
+        totalIterations = 0;
+        checkpointer.reset();
+        if (!checkpointPath.empty())
+            checkpointer = std::make_unique<Checkpointer>(checkpointPath, checkpointInterval);
+
+        int pendingK = 0; // k buscado antes de reduzir: retomada ou warm start com conflitos
+        SolverCheckpoint resumed;
+        if (loadCheckpoint(resumed))
+        {
+            colors = resumed.colors;
+            bestColors = resumed.bestColors;
+            bestK = resumed.bestK;
+            totalIterations = resumed.iteration;
+            rng.setState(resumed.rngState);
+            pendingK = resumed.k;
+            out << "Retomada do checkpoint: k = " << pendingK << " após " << totalIterations << " iterações\n";
+
+            // A melhor do arquivo só vale como legal depois de verificada neste grafo
+            ColoringReport resumedBest = verifier().verify(bestColors);
+            if (!resumedBest.isValid())
+            {
+                out << "Aviso: melhor coloração do checkpoint com " << resumedBest.conflicts << " conflitos; refeita pela estratégia inicial\n";
+                InitialColoring::color(initialStrategy, graph, bestColors);
+                resumedBest = verifier().verify(bestColors);
+            }
+            bestK = resumedBest.colorSpan();
+        }
+        else
+        {
+            initialColoring();
+            int k = n == 0 ? 0 : *std::max_element(colors.begin(), colors.end()) + 1;
+            bestColors = colors;
+            bestK = k;
+            if (!warmStart.empty() && verifier().verify(colors).conflicts > 0)
+            {
+                // A melhor legal até a partida ficar legal vem da estratégia inicial
+                pendingK = k;
+                InitialColoring::color(initialStrategy, graph, bestColors);
+                bestK = *std::max_element(bestColors.begin(), bestColors.end()) + 1;
+            }
+            out << "Coloração inicial: " << k << " cores\n";
+        }
+
+        int k = pendingK > 0 ? pendingK : bestK;
+        bool interrupted = false;
+        while (k > 1 && !deadline->targetReached(bestK, 0) && !budgetExhausted())
+        {
+            if (pendingK > 0)
+            {
+                pendingK = 0;
+            }
+            else
+            {
+                reduceColors(k - 1);
+                --k;
+            }
+
+            if (!tabuSearch(k))
+            {
+                interrupted = true;
+                break;
+            }
+
+            if (k < bestK)
+            {
+                bestColors = colors;
+                bestK = k;
+            }
+            out << "k = " << k << " legal após " << totalIterations << " iterações (" << elapsedSeconds() << " s)\n";
+        }
+
+        stopReason = deadline->stopReason();
+
+        // Parada por tempo ou pedido externo: grava onde a busca estava para continuar depois
+        if (checkpointer)
+        {
+            if (stopReason == SearchBudget::StopReason::TimeLimit || stopReason == SearchBudget::StopReason::Cancelled)
+            {
+                if (interrupted)
+                    saveCheckpoint(k, conflicts.getColors());
+                else
+                    saveCheckpoint(bestK, bestColors);
+            }
+            else
+            {
+                checkpointer->discard();
+            }
+        }
+
+        colors = bestColors;
+        verification = verifier().verify(colors);
+        double seconds = elapsedSeconds();
+        out << "Iterações: " << totalIterations << ", Tempo: " << seconds << " s, Iterações/s: "
+            << (seconds > 0 ? static_cast<long long>(totalIterations / seconds) : 0) << "\n";
+        if (stopReason != SearchBudget::StopReason::None)
+            out << "Parada: " << SearchBudget::describe(stopReason) << "\n";
+    }
+
+    // Busca tabu com k cores a partir da coloração atual; retorna true se chegou a zero conflitos.
+    bool tabuSearch(int k)
+    {
+        conflicts.build(graph, colors, k, ConflictTable::Backend::Table);
+        tabuUntil.assign(static_cast<size_t>(n) * k, 0);
+        rebuildConflictingVertices();
+        if (k < 2)
+            return conflicts.collisions() == 0;
+
+        int bestCollisions = conflicts.collisions();
+        long long iteration = 0;
+
+        while (conflicts.collisions() > 0)
+        {
+            if (budgetExhausted())
+                return false;
+
+            int moveVertex = -1;
+            int moveColor = -1;
+            int moveDelta = 0;
+            int ties = 0;
+
+            for (int v : conflictingVertices)
+            {
+                int current = conflicts.color(v);
+                int currentConflicts = conflicts.neighborsWithColor(v, current);
+                const long long *tabuRow = &tabuUntil[static_cast<size_t>(v) * k];
+
+                for (int c = 0; c < k; ++c)
+                {
+                    if (c == current)
+                        continue;
+
+                    int delta = conflicts.neighborsWithColor(v, c) - currentConflicts;
+                    bool aspiration = conflicts.collisions() + delta < bestCollisions;
+                    if (tabuRow[c] > iteration && !aspiration)
+                        continue;
+
+                    if (moveVertex == -1 || delta < moveDelta)
+                    {
+                        moveVertex = v;
+                        moveColor = c;
+                        moveDelta = delta;
+                        ties = 1;
+                    }
+                    else if (delta == moveDelta && rng.nextInt(++ties) == 0)
+                    {
+                        moveVertex = v;
+                        moveColor = c;
+                    }
+                }
+            }
+
+            // Todos os movimentos tabu: sorteia um vértice conflitante
+            if (moveVertex == -1)
+            {
+                moveVertex = conflictingVertices[rng.nextInt(static_cast<int>(conflictingVertices.size()))];
+                moveColor = rng.nextInt(k - 1);
+                if (moveColor >= conflicts.color(moveVertex))
+                    ++moveColor;
+            }
+
+            int oldColor = conflicts.color(moveVertex);
+            recolor(moveVertex, moveColor);
+
+            int tenure = tenureBase + rng.nextInt(tenureRandom + 1) +
+                         static_cast<int>(tenureAlpha * static_cast<double>(conflictingVertices.size()));
+            tabuUntil[static_cast<size_t>(moveVertex) * k + oldColor] = iteration + tenure;
+
+            ++iteration;
+            ++totalIterations;
+            bestCollisions = std::min(bestCollisions, conflicts.collisions());
+            if (checkpointer && checkpointer->due())
+                saveCheckpoint(k, conflicts.getColors());
+        }
+
+        colors = conflicts.getColors();
+        return true;
+    }
+
+    void printColors() const
+    {
+        out << "Número de cores diferentes usadas: " << bestK << "\n";
+        out << "Colisões finais: " << verification.conflicts << "\n";
+        if (budget.getLowerBound() > 0)
+            out << "Gap para o limite inferior: " << budget.gap(bestK) << "\n";
+    }
+
+    const std::vector<int> &getColors() const { return colors; }
+    int getNumColors() const { return bestK; }
+
+    // Verificação completa da coloração final (conflitos, cores usadas, arestas em conflito).
+    const ColoringReport &getVerification() const { return verification; }
+    long long getIterations() const { return totalIterations; }
+
+private:
+    int n;
+    const Graph &graph;
+    double timeLimitSeconds;
+    long long maxIterations;
+    std::vector<int> colors;
+    std::vector<int> bestColors;
+    int bestK = 0;
+    long long totalIterations = 0;
+    SearchBudget budget;
+    std::unique_ptr<Deadline> deadline;
+    SearchBudget::StopReason stopReason = SearchBudget::StopReason::None;
+
+    int tenureBase = 0;
+    int tenureRandom = 9;
+    double tenureAlpha = 0.6;
+
+    ConflictTable conflicts;
+    std::vector<long long> tabuUntil;     // iteração até a qual (v, c) é tabu
+    std::vector<int> conflictingVertices; // vértices com ao menos um vizinho da mesma cor
+    std::vector<int> conflictPosition;    // posição em conflictingVertices ou -1
+
+    std::ostream &out;
+    Xoshiro256 rng;
+    InitialColoringStrategy initialStrategy = InitialColoringStrategy::DSatur;
+    std::vector<int> warmStart; // vazio: coloração inicial pela estratégia
+    std::string checkpointPath;
+    double checkpointInterval = 0;
+    std::unique_ptr<Checkpointer> checkpointer;
+    GraphFingerprint fingerprint; // calculado ao procurar o checkpoint, antes de qualquer gravação
+    bool fingerprinted = false;
+    std::unique_ptr<ColoringVerifier> coloringVerifier;
+    ColoringReport verification;
+
+    // Carrega o checkpoint, se houver um do TabuCol para este grafo.
+    bool loadCheckpoint(SolverCheckpoint &checkpoint)
+    {
+        if (checkpointPath.empty())
+            return false;
+        if (!fingerprinted)
+        {
+            fingerprint = GraphFingerprint::of(graph);
+            fingerprinted = true;
+        }
+        return SolverCheckpoint::loadMatching(checkpointPath, "TabuCol", 0, 0, fingerprint, checkpoint, out);
+    }
+
+    void saveCheckpoint(int k, const std::vector<int> &current) const
+    {
+        SolverCheckpoint checkpoint;
+        checkpoint.solver = "TabuCol";
+        checkpoint.graph = fingerprint;
+        checkpoint.k = k;
+        checkpoint.bestK = bestK;
+        checkpoint.iteration = totalIterations;
+        std::copy(rng.state(), rng.state() + 4, checkpoint.rngState);
+        checkpoint.colors = current;
+        checkpoint.bestColors = bestColors;
+        checkpointer->write(checkpoint);
+    }
+
+    double elapsedSeconds() const
+    {
+        return deadline->elapsedSeconds();
+    }
+
+    // Chamado a cada iteração: o relógio só é lido de tempos em tempos (Deadline).
+    bool budgetExhausted()
+    {
+        return (maxIterations > 0 && totalIterations >= maxIterations) || deadline->expired();
+    }
+
+    // Remove a cor k: cada vértice dela vai para a cor de menor conflito entre as restantes.
+    void reduceColors(int k)
+    {
+        conflicts.build(graph, colors, k + 1, ConflictTable::Backend::Table);
+        for (int v = 0; v < n; ++v)
+        {
+            if (colors[v] != k)
+                continue;
+
+            int bestColor = 0;
+            for (int c = 1; c < k; ++c)
+            {
+                if (conflicts.neighborsWithColor(v, c) < conflicts.neighborsWithColor(v, bestColor))
+                    bestColor = c;
+            }
+            conflicts.recolor(v, bestColor);
+        }
+        colors = conflicts.getColors();
+    }
+
+    void rebuildConflictingVertices()
+    {
+        conflictingVertices.clear();
+        std::fill(conflictPosition.begin(), conflictPosition.end(), -1);
+        for (int v = 0; v < n; ++v)
+            updateConflictState(v);
+    }
+
+    void updateConflictState(int v)
+    {
+        bool conflicting = conflicts.neighborsWithColor(v, conflicts.color(v)) > 0;
+        if (conflicting && conflictPosition[v] == -1)
+        {
+            conflictPosition[v] = static_cast<int>(conflictingVertices.size());
+            conflictingVertices.push_back(v);
+        }
+        else if (!conflicting && conflictPosition[v] != -1)
+        {
+            int last = conflictingVertices.back();
+            conflictingVertices[conflictPosition[v]] = last;
+            conflictPosition[last] = conflictPosition[v];
+            conflictingVertices.pop_back();
+            conflictPosition[v] = -1;
+        }
+    }
+
+    void recolor(int v, int c)
+    {
+        conflicts.recolor(v, c);
+        updateConflictState(v);
+        for (int u : graph.neighborsOf(v))
+            updateConflictState(u);
+    }
+
+    const ColoringVerifier &verifier()
+    {
+        if (!coloringVerifier)
+            coloringVerifier = std::make_unique<ColoringVerifier>(graph);
+        return *coloringVerifier;
+    }
+};
+
+#endif // GRAPH_COLORING_TABUCOL_H
@@ -0,0 +1,119 @@
+#ifndef GRAPH_COMPONENTS_H
+#define GRAPH_COMPONENTS_H
+
+#include <vector>
+#include <numeric>
+#include <utility>
+
+// Conjuntos disjuntos com união por tamanho e compressão de caminho por halving.
+class DisjointSets
+{
+public:
+    explicit DisjointSets(int n = 0) : parent(n), size(n, 1)
+    {
+        std::iota(parent.begin(), parent.end(), 0);
+    }
+
+    int find(int v)
+    {
+        while (parent[v] != v)
+        {
+            parent[v] = parent[parent[v]];
+            v = parent[v];
+        }
+        return v;
+    }
+
+    bool unite(int a, int b)
+    {
+        a = find(a);
+        b = find(b);
+        if (a == b)
+            return false;
+        if (size[a] < size[b])
+            std::swap(a, b);
+        parent[b] = a;
+        size[a] += size[b];
+        return true;
+    }
+
+private:
+    std::vector<int> parent;
+    std::vector<int> size;
+};
+
+// Índice de componentes conexas de um grafo CSR, calculado uma única vez (sem
+// recursão). As componentes são numeradas na ordem do seu menor vértice e os
+// vértices de cada uma ficam contíguos, em ordem crescente, em
+// vertices[offsets[c] .. offsets[c + 1]).
+class GraphComponents
+{
+public:
+    class VertexRange
+    {
+    public:
+        VertexRange(const int *first, const int *last) : first(first), last(last) {}
+
+        const int *begin() const { return first; }
+        const int *end() const { return last; }
+        int size() const { return static_cast<int>(last - first); }
+
+    private:
+        const int *first;
+        const int *last;
+    };
+
+    GraphComponents() : offsets(1, 0) {}
+
+    GraphComponents(int n, const std::vector<int> &csrOffsets, const std::vector<int> &csrNeighbors)
+        : componentId(n, -1)
+    {
+        DisjointSets sets(n);
+        for (int v = 0; v < n; ++v)
+        {
+            for (int i = csrOffsets[v]; i < csrOffsets[v + 1]; ++i)
+            {
+                if (v < csrNeighbors[i])
+                    sets.unite(v, csrNeighbors[i]);
+            }
+        }
+
+        // Numera as raízes na ordem do menor vértice de cada componente
+        std::vector<int> rootId(n, -1);
+        int count = 0;
+        for (int v = 0; v < n; ++v)
+        {
+            int root = sets.find(v);
+            if (rootId[root] == -1)
+                rootId[root] = count++;
+            componentId[v] = rootId[root];
+        }
+
+        offsets.assign(count + 1, 0);
+        for (int v = 0; v < n; ++v)
+            ++offsets[componentId[v] + 1];
+        for (int c = 0; c < count; ++c)
+            offsets[c + 1] += offsets[c];
+
+        vertices.resize(n);
+        std::vector<int> next(offsets.begin(), offsets.end() - 1);
+        for (int v = 0; v < n; ++v)
+            vertices[next[componentId[v]]++] = v;
+    }
+
+    int count() const { return static_cast<int>(offsets.size()) - 1; }
+    int componentOf(int v) const { return componentId[v]; }
+    int sizeOf(int component) const { return offsets[component + 1] - offsets[component]; }
+
+    VertexRange verticesOf(int component) const
+    {
+        return VertexRange(vertices.data() + offsets[component], vertices.data() + offsets[component + 1]);
+    }
+
+private:
+    std::vector<int> componentId;
+    std::vector<int> offsets;
+    std::vector<int> vertices;
+};
+
+#endif // GRAPH_COMPONENTS_H
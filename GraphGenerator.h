@@ -0,0 +1,444 @@
+#ifndef GRAPH_GENERATOR_H
+#define GRAPH_GENERATOR_H
+
+#include <charconv>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "Graph.h"
+#include "GraphCache.h"
+#include "Random.h"
+
+enum class GeneratorModel
+{
+    Random,    // G(n, p) com p = grau médio / (n - 1)
+    Geometric, // pontos no quadrado unitário, aresta entre os que distam menos que r
+    Leighton,  // k-coloração plantada: arestas só entre classes diferentes, mais um k-clique
+    Mycielski  // construção de Mycielski iterada a partir de K2 (mesma família das instâncias MYC)
+};
+
+struct GeneratorSpec
+{
+    GeneratorModel model = GeneratorModel::Random;
+    int vertices = 100000;
+    double averageDegree = 10.0;
+    int colors = 10; // Leighton: k plantado
+    int level = 0;   // Mycielski: myciel<level> do DIMACS (χ = level + 1); 0 = o maior com até `vertices`
+    uint64_t seed = 1;
+
+    static GeneratorModel parseModel(const std::string &name)
+    {
+        if (name == "gnp")
+            return GeneratorModel::Random;
+        if (name == "geometric")
+            return GeneratorModel::Geometric;
+        if (name == "leighton")
+            return GeneratorModel::Leighton;
+        if (name == "mycielski")
+            return GeneratorModel::Mycielski;
+        throw std::runtime_error("modelo de grafo desconhecido: " + name);
+    }
+
+    static std::string modelName(GeneratorModel model)
+    {
+        switch (model)
+        {
+        case GeneratorModel::Geometric:
+            return "geometric";
+        case GeneratorModel::Leighton:
+            return "leighton";
+        case GeneratorModel::Mycielski:
+            return "mycielski";
+        default:
+            return "gnp";
+        }
+    }
+};
+
+// Grafos sintéticos grandes, gerados como fluxo de arestas: forEachEdge() chama
+// emit(u, v) uma vez por aresta (u != v, sem repetição) e pode ser repetido, com
+// a mesma sequência para a mesma semente. Assim a contagem de arestas (que o
+// cabeçalho DIMACS precisa antes delas) e a escrita são passadas separadas, e a
+// memória fica em O(n) (pontos do geométrico, classes do Leighton) em vez de O(m).
+//
+// O modelo Leighton aqui é simplificado: classes de cor sorteadas, arestas
+// uniformes entre classes diferentes e um clique com um vértice de cada classe
+// nos k primeiros ids, o que fixa χ = k (o gerador original de Leighton planta
+// cliques de vários tamanhos para controlar a dificuldade).
+class GraphGenerator
+{
+public:
+    // Resultado de writeDimacs: tamanho e hash do arquivo, para o cache binário.
+    struct FileInfo
+    {
+        uint64_t size = 0;
+        uint64_t hash = 0;
+    };
+
+    explicit GraphGenerator(const GeneratorSpec &spec) : spec(spec)
+    {
+        if (spec.model == GeneratorModel::Mycielski)
+        {
+            level = spec.level;
+            if (level <= 0)
+            {
+                level = 1;
+                while (mycielskiVertices(level + 1) <= spec.vertices)
+                    ++level;
+            }
+            if (mycielskiVertices(level) > INT_MAX)
+                throw std::runtime_error("myciel" + std::to_string(level) + " tem vértices demais");
+            n = static_cast<int>(mycielskiVertices(level));
+            requireIndexable(static_cast<double>(mycielskiEdges(level)));
+            return;
+        }
+
+        n = spec.vertices;
+        if (n < 1)
+            throw std::runtime_error("o grafo precisa de ao menos um vértice");
+        double p = n > 1 ? spec.averageDegree / (n - 1) : 0;
+        requireIndexable(spec.averageDegree * n / 2);
+
+        Xoshiro256 rng(Xoshiro256::deriveSeed(spec.seed, 0));
+        if (spec.model == GeneratorModel::Leighton)
+        {
+            if (spec.colors < 2 || spec.colors > n)
+                throw std::runtime_error("o número de cores plantadas deve estar entre 2 e n");
+            // Só pares de classes diferentes são sorteados: a densidade compensa a fração (1 - 1/k) deles
+            p /= 1.0 - 1.0 / spec.colors;
+            colorClass.resize(n);
+            for (int v = 0; v < n; ++v)
+                colorClass[v] = v < spec.colors ? v : rng.nextInt(spec.colors);
+        }
+        else if (spec.model == GeneratorModel::Geometric)
+        {
+            buildPoints(rng);
+        }
+        edgeProbability = std::min(1.0, std::max(0.0, p));
+    }
+
+    int getNumVertices() const { return n; }
+    int getLevel() const { return level; }
+
+    // Coloração plantada do modelo Leighton (vazia nos outros modelos).
+    const std::vector<int> &plantedColoring() const { return colorClass; }
+
+    template <typename Emit>
+    void forEachEdge(Emit &&emit) const
+    {
+        switch (spec.model)
+        {
+        case GeneratorModel::Geometric:
+            geometricEdges(emit);
+            break;
+        case GeneratorModel::Mycielski:
+            mycielskiEdges(level, std::function<void(int, int)>(emit));
+            break;
+        case GeneratorModel::Leighton:
+        {
+            const int k = spec.colors;
+            randomEdges([&](int u, int v)
+                        {
+                            if (colorClass[u] != colorClass[v] && v >= k)
+                                emit(u, v); });
+            for (int v = 1; v < k; ++v)
+            {
+                for (int u = 0; u < v; ++u)
+                    emit(u, v);
+            }
+            break;
+        }
+        default:
+            randomEdges(emit);
+            break;
+        }
+    }
+
+    // Uma passada só para contar; degrees (opcional) recebe o grau de cada vértice.
+    long long countEdges(std::vector<int> *degrees = nullptr) const
+    {
+        long long edges = 0;
+        if (degrees)
+            degrees->assign(n, 0);
+        forEachEdge([&](int u, int v)
+                    {
+                        ++edges;
+                        if (degrees)
+                        {
+                            ++(*degrees)[u];
+                            ++(*degrees)[v];
+                        } });
+        return edges;
+    }
+
+    // DIMACS ("p edge n m" e linhas "e u v", vértices a partir de 1) gravado em blocos,
+    // com o hash FNV-1a calculado no caminho, como o GraphCache espera.
+    FileInfo writeDimacs(const std::string &path, long long numEdges) const
+    {
+        if (numEdges > INT_MAX)
+            throw std::runtime_error("arestas demais para o formato DIMACS lido pelo InstanceReader");
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out.is_open())
+            throw std::runtime_error(path + ": não foi possível gravar a instância");
+
+        FileInfo info;
+        info.hash = 14695981039346656037ULL;
+        std::string buffer;
+        buffer.reserve(WRITE_BLOCK + 64);
+        auto flush = [&]
+        {
+            for (char byte : buffer)
+            {
+                info.hash ^= static_cast<unsigned char>(byte);
+                info.hash *= 1099511628211ULL;
+            }
+            out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            info.size += buffer.size();
+            buffer.clear();
+        };
+
+        buffer += "c " + describe() + "\n";
+        buffer += "p edge " + std::to_string(n) + " " + std::to_string(numEdges) + "\n";
+        char digits[16];
+        forEachEdge([&](int u, int v)
+                    {
+                        buffer += "e ";
+                        buffer.append(digits, std::to_chars(digits, digits + sizeof(digits), u + 1).ptr);
+                        buffer += ' ';
+                        buffer.append(digits, std::to_chars(digits, digits + sizeof(digits), v + 1).ptr);
+                        buffer += '\n';
+                        if (buffer.size() >= WRITE_BLOCK)
+                            flush(); });
+        flush();
+        if (!out.good())
+            throw std::runtime_error(path + ": erro ao gravar a instância");
+        return info;
+    }
+
+    // Cache binário (CSR do GraphCache) de uma instância gravada por writeDimacs: o
+    // InstanceReader passa a carregá-la sem o parse. O CSR é montado direto pelos
+    // graus (mais uma passada), sem vetor de arestas.
+    Graph buildGraph(const std::vector<int> &degrees) const
+    {
+        std::vector<int> offsets(n + 1, 0);
+        for (int v = 0; v < n; ++v)
+        {
+            if (offsets[v] > INT_MAX - degrees[v])
+                throw std::runtime_error("arestas demais para o CSR (índices de 32 bits)");
+            offsets[v + 1] = offsets[v] + degrees[v];
+        }
+
+        std::vector<int> neighbors(offsets[n]);
+        std::vector<int> next(offsets.begin(), offsets.end() - 1);
+        forEachEdge([&](int u, int v)
+                    {
+                        neighbors[next[u]++] = v;
+                        neighbors[next[v]++] = u; });
+        for (int v = 0; v < n; ++v)
+            std::sort(neighbors.begin() + offsets[v], neighbors.begin() + offsets[v + 1]);
+        return Graph(n, std::move(offsets), std::move(neighbors), {});
+    }
+
+    void writeCache(const std::string &dimacsPath, const FileInfo &dimacs, const std::vector<int> &degrees) const
+    {
+        if (!GraphCache::write(GraphCache::cachePathFor(dimacsPath), buildGraph(degrees), dimacs.size, dimacs.hash))
+            throw std::runtime_error(GraphCache::cachePathFor(dimacsPath) + ": não foi possível gravar o cache");
+    }
+
+    std::string describe() const
+    {
+        std::ostringstream text;
+        text << GeneratorSpec::modelName(spec.model) << " n=" << n;
+        if (spec.model == GeneratorModel::Mycielski)
+        {
+            text << " nível=" << level;
+            return text.str();
+        }
+        text << " grau=" << spec.averageDegree;
+        if (spec.model == GeneratorModel::Leighton)
+            text << " k=" << spec.colors;
+        text << " semente=" << spec.seed;
+        return text.str();
+    }
+
+    // Vértices de myciel<level>: myciel1 = K2 e cada passo leva n a 2n + 1.
+    static long long mycielskiVertices(int level)
+    {
+        return level >= 62 ? LLONG_MAX : 3LL * (1LL << (level - 1)) - 1;
+    }
+
+    // Arestas de myciel<level>: m' = 3m + n.
+    static long long mycielskiEdges(int level)
+    {
+        long long edges = 1;
+        for (int l = 2; l <= level && edges < LLONG_MAX / 4; ++l)
+            edges = 3 * edges + mycielskiVertices(l - 1);
+        return edges;
+    }
+
+private:
+    static constexpr size_t WRITE_BLOCK = 1 << 20;
+
+    GeneratorSpec spec;
+    int n = 0;
+    int level = 0;
+    double edgeProbability = 0;
+    std::vector<int> colorClass;
+
+    // Geométrico: pontos e grade de células de lado >= r, com os vértices de cada célula contíguos
+    double radius = 0;
+    int gridSide = 1;
+    std::vector<float> pointX;
+    std::vector<float> pointY;
+    std::vector<int> cellStart;
+    std::vector<int> cellVertices;
+
+    // O CSR do Graph indexa as 2m entradas de vizinhos com int: falha antes de gerar.
+    static void requireIndexable(double expectedEdges)
+    {
+        if (2 * expectedEdges > INT_MAX)
+            throw std::runtime_error("cerca de " + std::to_string(static_cast<long long>(expectedEdges)) +
+                                     " arestas: acima do limite do Graph (índices de 32 bits)");
+    }
+
+    // G(n, p) por saltos geométricos (Batagelj e Brandes): O(n + m) em vez de O(n²).
+    template <typename Emit>
+    void randomEdges(Emit &&emit) const
+    {
+        if (edgeProbability <= 0)
+            return;
+        Xoshiro256 rng(Xoshiro256::deriveSeed(spec.seed, 1));
+        if (edgeProbability >= 1)
+        {
+            for (int v = 1; v < n; ++v)
+            {
+                for (int u = 0; u < v; ++u)
+                    emit(u, v);
+            }
+            return;
+        }
+
+        const double logSkip = std::log(1.0 - edgeProbability);
+        long long v = 1;
+        long long w = -1;
+        while (v < n)
+        {
+            w += 1 + static_cast<long long>(std::floor(std::log(1.0 - rng.nextDouble()) / logSkip));
+            while (w >= v && v < n)
+            {
+                w -= v;
+                ++v;
+            }
+            if (v < n)
+                emit(static_cast<int>(w), static_cast<int>(v));
+        }
+    }
+
+    // Raio para o grau médio pedido, desprezando a borda: n·π·r² = grau.
+    void buildPoints(Xoshiro256 &rng)
+    {
+        radius = std::sqrt(spec.averageDegree / (std::acos(-1.0) * std::max(1, n)));
+        gridSide = std::max(1, std::min(static_cast<int>(1.0 / std::max(radius, 1e-9)), static_cast<int>(std::sqrt(static_cast<double>(n)))));
+
+        pointX.resize(n);
+        pointY.resize(n);
+        std::vector<int> cellOf(n);
+        cellStart.assign(static_cast<size_t>(gridSide) * gridSide + 1, 0);
+        for (int v = 0; v < n; ++v)
+        {
+            pointX[v] = static_cast<float>(rng.nextDouble());
+            pointY[v] = static_cast<float>(rng.nextDouble());
+            cellOf[v] = cellIndex(pointX[v]) * gridSide + cellIndex(pointY[v]);
+            ++cellStart[cellOf[v] + 1];
+        }
+        for (size_t c = 1; c < cellStart.size(); ++c)
+            cellStart[c] += cellStart[c - 1];
+
+        cellVertices.resize(n);
+        std::vector<int> next(cellStart.begin(), cellStart.end() - 1);
+        for (int v = 0; v < n; ++v)
+            cellVertices[next[cellOf[v]]++] = v;
+    }
+
+    int cellIndex(float coordinate) const
+    {
+        return std::min(gridSide - 1, static_cast<int>(coordinate * gridSide));
+    }
+
+    // Cada par é visto uma vez: dentro da célula e com as quatro células vizinhas "à frente".
+    template <typename Emit>
+    void geometricEdges(Emit &&emit) const
+    {
+        const float limit = static_cast<float>(radius * radius);
+        const int forward[4][2] = {{0, 1}, {1, -1}, {1, 0}, {1, 1}};
+        auto close = [&](int u, int v)
+        {
+            float dx = pointX[u] - pointX[v];
+            float dy = pointY[u] - pointY[v];
+            return dx * dx + dy * dy < limit;
+        };
+
+        for (int cx = 0; cx < gridSide; ++cx)
+        {
+            for (int cy = 0; cy < gridSide; ++cy)
+            {
+                int cell = cx * gridSide + cy;
+                for (int i = cellStart[cell]; i < cellStart[cell + 1]; ++i)
+                {
+                    int u = cellVertices[i];
+                    for (int j = i + 1; j < cellStart[cell + 1]; ++j)
+                    {
+                        int v = cellVertices[j];
+                        if (close(u, v))
+                            emit(std::min(u, v), std::max(u, v));
+                    }
+
+                    for (const auto &offset : forward)
+                    {
+                        int nx = cx + offset[0];
+                        int ny = cy + offset[1];
+                        if (nx < 0 || nx >= gridSide || ny < 0 || ny >= gridSide)
+                            continue;
+                        int other = nx * gridSide + ny;
+                        for (int j = cellStart[other]; j < cellStart[other + 1]; ++j)
+                        {
+                            int v = cellVertices[j];
+                            if (close(u, v))
+                                emit(std::min(u, v), std::max(u, v));
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // myciel<level> a partir de myciel<level-1> com n vértices: cada aresta (a, b)
+    // gera também (a, n+b) e (b, n+a), e o vértice 2n liga-se a n..2n-1.
+    static void mycielskiEdges(int level, const std::function<void(int, int)> &emit)
+    {
+        if (level <= 1)
+        {
+            emit(0, 1);
+            return;
+        }
+        int previous = static_cast<int>(mycielskiVertices(level - 1));
+        mycielskiEdges(level - 1, [&](int a, int b)
+                       {
+                           emit(a, b);
+                           emit(a, previous + b);
+                           emit(b, previous + a); });
+        for (int i = 0; i < previous; ++i)
+            emit(previous + i, 2 * previous);
+    }
+};
+
+#endif // GRAPH_GENERATOR_H
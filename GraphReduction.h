@@ -0,0 +1,208 @@
+#ifndef GRAPH_REDUCTION_H
+#define GRAPH_REDUCTION_H
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include "Graph.h"
+
+// Pré-processamento entre o InstanceReader e os solvers. Dado k (um limite inferior
+// do número cromático, ex.: o clique), remove repetidamente:
+//  - vértices com grau < k: depois que o núcleo estiver colorido, sempre sobra uma
+//    das k primeiras cores para eles;
+//  - vértices dominados: u não adjacente a v com N(u) ⊆ N(v) pode repetir a cor de v.
+// O que sobra é o núcleo, renumerado 0..m-1, que é o grafo entregue aos solvers.
+// extend() desfaz as remoções em ordem inversa e devolve a coloração do grafo todo
+// sem usar mais do que max(cores do núcleo, k) cores nem criar conflitos novos. O
+// grafo original precisa continuar vivo enquanto a redução for usada.
+//
+// O núcleo não é partido em componentes conexas: o custo é a maior cor, o máximo
+// entre as componentes, e os solvers já as tratam separadamente onde isso ajuda
+// (GraphComponents no vizinho 1 da busca local e da têmpera).
+class GraphReduction
+{
+public:
+    GraphReduction(const Graph &graph, int k) : n(graph.getNumVertices()), k(k)
+    {
+        alive.assign(n, 1);
+        degree.resize(n);
+        for (int v = 0; v < n; ++v)
+            degree[v] = graph.degree(v);
+
+        std::vector<int> queue;
+        auto peelFrom = [&](std::vector<int> &pending)
+        {
+            while (!pending.empty())
+            {
+                int v = pending.back();
+                pending.pop_back();
+                if (!alive[v] || degree[v] >= k)
+                    continue;
+                remove(graph, v, -1, pending);
+            }
+        };
+
+        for (int v = 0; v < n; ++v)
+            queue.push_back(v);
+        peelFrom(queue);
+
+        // Dominância com orçamento de trabalho proporcional ao tamanho do grafo
+        long long work = 0;
+        const long long workLimit = 16LL * static_cast<long long>(graph.getNeighbors().size()) + n;
+        std::vector<int> mark(n, -1);
+        bool changed = true;
+        while (changed && work < workLimit)
+        {
+            changed = false;
+            for (int u = 0; u < n && work < workLimit; ++u)
+            {
+                if (!alive[u])
+                    continue;
+                int dominator = findDominator(graph, u, mark, work);
+                if (dominator == -1)
+                    continue;
+
+                remove(graph, u, dominator, queue);
+                peelFrom(queue);
+                changed = true;
+            }
+        }
+
+        coreIndex.assign(n, -1);
+        for (int v = 0; v < n; ++v)
+        {
+            if (alive[v])
+            {
+                coreIndex[v] = static_cast<int>(coreVertices.size());
+                coreVertices.push_back(v);
+            }
+        }
+
+        std::vector<std::pair<int, int>> edges;
+        for (int v : coreVertices)
+        {
+            for (int u : graph.neighborsOf(v))
+            {
+                if (alive[u] && v < u)
+                    edges.emplace_back(coreIndex[v], coreIndex[u]);
+            }
+        }
+        coreGraph = Graph(static_cast<int>(coreVertices.size()), edges);
+        original = &graph;
+    }
+
+    const Graph &core() const { return coreGraph; }
+    const std::vector<int> &getCoreVertices() const { return coreVertices; }
+    int getNumPeeled() const { return numPeeled; }
+    int getNumDominated() const { return numDominated; }
+    int getNumRemoved() const { return numPeeled + numDominated; }
+
+    // Coloração do grafo todo -> coloração do núcleo (ex.: warm start de uma execução anterior).
+    std::vector<int> restrictToCore(const std::vector<int> &colors) const
+    {
+        std::vector<int> coreColors(coreVertices.size());
+        for (size_t i = 0; i < coreVertices.size(); ++i)
+            coreColors[i] = colors[coreVertices[i]];
+        return coreColors;
+    }
+
+    // Coloração do grafo original a partir da do núcleo.
+    std::vector<int> extend(const std::vector<int> &coreColors) const
+    {
+        std::vector<int> colors(n, -1);
+        for (size_t i = 0; i < coreVertices.size(); ++i)
+            colors[coreVertices[i]] = coreColors[i];
+
+        int maxColor = coreColors.empty() ? 0 : *std::max_element(coreColors.begin(), coreColors.end());
+        std::vector<int> stamp(std::max(n, maxColor) + 2, -1);
+        for (auto it = removed.rbegin(); it != removed.rend(); ++it)
+        {
+            int v = it->first;
+            int dominator = it->second;
+            if (dominator != -1)
+            {
+                colors[v] = colors[dominator];
+                continue;
+            }
+
+            for (int u : original->neighborsOf(v))
+            {
+                if (colors[u] != -1)
+                    stamp[colors[u]] = v;
+            }
+            int color = 0;
+            while (stamp[color] == v)
+                ++color;
+            colors[v] = color;
+        }
+        return colors;
+    }
+
+private:
+    int n;
+    int k;
+    const Graph *original = nullptr;
+    Graph coreGraph;
+    std::vector<char> alive;
+    std::vector<int> degree; // grau entre os vértices ainda presentes
+    std::vector<std::pair<int, int>> removed; // (vértice, dominador ou -1 se por grau), em ordem de remoção
+    std::vector<int> coreVertices;
+    std::vector<int> coreIndex;
+    int numPeeled = 0;
+    int numDominated = 0;
+
+    void remove(const Graph &graph, int v, int dominator, std::vector<int> &pending)
+    {
+        alive[v] = 0;
+        removed.emplace_back(v, dominator);
+        if (dominator == -1)
+            ++numPeeled;
+        else
+            ++numDominated;
+
+        for (int u : graph.neighborsOf(v))
+        {
+            if (alive[u] && --degree[u] < k)
+                pending.push_back(u);
+        }
+    }
+
+    // Procura v presente, não adjacente a u, com N(u) ⊆ N(v). Os candidatos são os
+    // vizinhos do vizinho de u de menor grau (todo dominador é vizinho dele).
+    int findDominator(const Graph &graph, int u, std::vector<int> &mark, long long &work)
+    {
+        int pivot = -1;
+        for (int w : graph.neighborsOf(u))
+        {
+            if (alive[w])
+            {
+                mark[w] = u;
+                if (pivot == -1 || degree[w] < degree[pivot])
+                    pivot = w;
+            }
+        }
+        work += graph.degree(u);
+        if (pivot == -1)
+            return -1;
+        work += graph.degree(pivot);
+
+        for (int v : graph.neighborsOf(pivot))
+        {
+            if (v == u || !alive[v] || mark[v] == u || degree[v] < degree[u])
+                continue;
+
+            int covered = 0;
+            for (int x : graph.neighborsOf(v))
+            {
+                if (alive[x] && mark[x] == u)
+                    ++covered;
+            }
+            work += graph.degree(v);
+            if (covered == degree[u])
+                return v;
+        }
+        return -1;
+    }
+};
+
+#endif // GRAPH_REDUCTION_H
@@ -0,0 +1,252 @@
+#ifndef INITIAL_COLORING_H
+#define INITIAL_COLORING_H
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include "Graph.h"
+#include "BucketQueue.h"
+#include "BitsetGraph.h"
+
+enum class InitialColoringStrategy
+{
+    Greedy, // Guloso na ordem decrescente de grau
+    DSatur, // Maior grau de saturação primeiro (Brélaz)
+    RLF     // Recursive Largest First (Leighton)
+};
+
+// Heurísticas construtivas. Todas preenchem colors (cores a partir de 0, coloração
+// legal) e devolvem o número de cores usadas. A menor cor livre de um vértice é
+// achada com um único vetor de marcas reaproveitado (marca = vértice corrente),
+// sem alocar nada por vértice.
+namespace InitialColoring
+{
+    inline int smallestFreeColor(const Graph &graph, int v, const std::vector<int> &colors, std::vector<int> &stamp)
+    {
+        for (int u : graph.neighborsOf(v))
+        {
+            if (colors[u] != -1)
+                stamp[colors[u]] = v;
+        }
+
+        int color = 0;
+        while (stamp[color] == v)
+            ++color;
+        return color;
+    }
+
+    inline int greedy(const Graph &graph, std::vector<int> &colors)
+    {
+        const int n = graph.getNumVertices();
+        colors.assign(n, -1);
+        std::vector<int> stamp(n + 1, -1);
+
+        int numColors = 0;
+        for (int v : graph.getDegreeOrder())
+        {
+            colors[v] = smallestFreeColor(graph, v, colors, stamp);
+            numColors = std::max(numColors, colors[v] + 1);
+        }
+        return numColors;
+    }
+
+    // DSatur com fila por baldes: chave = saturação (e grau, quando a faixa de chaves
+    // combinadas cabe na memória). Cada vértice guarda o bitset das cores 0..grau(v)
+    // dos vizinhos (O(n + m/64) palavras no total): a menor cor livre de v é sempre
+    // <= grau(v), então é o primeiro bit zero. A saturação é mantida incrementalmente;
+    // uma cor acima de grau(u) não cabe no bitset de u e só é nova se nenhum outro
+    // vizinho de u já a tiver, o que se confere varrendo os grau(u) < cor vizinhos.
+    inline int dsatur(const Graph &graph, std::vector<int> &colors)
+    {
+        const int n = graph.getNumVertices();
+        colors.assign(n, -1);
+        if (n == 0)
+            return 0;
+
+        int maxDegree = graph.degree(graph.getDegreeOrder()[0]);
+        std::vector<size_t> wordOffset(n + 1, 0);
+        for (int v = 0; v < n; ++v)
+            wordOffset[v + 1] = wordOffset[v] + (graph.degree(v) + 1 + 63) / 64;
+        std::vector<uint64_t> neighborColors(wordOffset[n], 0);
+        std::vector<int> saturation(n, 0);
+
+        // Desempate por grau só se a faixa (saturação x grau) for pequena
+        const long long combinedKeys = static_cast<long long>(maxDegree + 2) * (maxDegree + 1);
+        const bool tieByDegree = combinedKeys <= 4LL * n + (1 << 20);
+        auto key = [&](int v)
+        {
+            return tieByDegree ? -(saturation[v] * (maxDegree + 1) + graph.degree(v)) : -saturation[v];
+        };
+
+        BucketQueue queue;
+        queue.reset(n, tieByDegree ? static_cast<int>(-combinedKeys) : -(maxDegree + 1), 0);
+        // Inserção em ordem crescente de grau: o topo de cada balde (LIFO) é o de maior grau
+        const std::vector<int> &order = graph.getDegreeOrder();
+        for (auto it = order.rbegin(); it != order.rend(); ++it)
+            queue.insert(*it, key(*it));
+
+        int numColors = 0;
+        while (!queue.empty())
+        {
+            int v = queue.top();
+            queue.remove(v);
+
+            // Menor cor livre = primeiro bit zero do bitset de cores dos vizinhos
+            const uint64_t *used = &neighborColors[wordOffset[v]];
+            int w = 0;
+            while (used[w] == ~uint64_t(0))
+                ++w;
+            int color = w * 64 + BitsetKernels::countTrailingZeros64(~used[w]);
+            colors[v] = color;
+            numColors = std::max(numColors, color + 1);
+
+            const uint64_t bit = uint64_t(1) << (color & 63);
+            for (int u : graph.neighborsOf(v))
+            {
+                if (colors[u] != -1)
+                    continue;
+
+                bool isNew;
+                if (color <= graph.degree(u))
+                {
+                    uint64_t &word = neighborColors[wordOffset[u] + (color >> 6)];
+                    isNew = (word & bit) == 0;
+                    word |= bit;
+                }
+                else
+                {
+                    isNew = true;
+                    for (int x : graph.neighborsOf(u))
+                    {
+                        if (x != v && colors[x] == color)
+                        {
+                            isNew = false;
+                            break;
+                        }
+                    }
+                }
+
+                if (isNew)
+                {
+                    ++saturation[u];
+                    queue.update(u, key(u));
+                }
+            }
+        }
+        return numColors;
+    }
+
+    // RLF: monta uma classe de cor por vez. Começa pelo vértice não colorido com mais
+    // vizinhos não coloridos e segue escolhendo o candidato com mais vizinhos já
+    // excluídos da classe (desempate: menos vizinhos não coloridos, quando a faixa de
+    // chaves combinadas cabe na memória, como no DSatur). Os candidatos ficam numa
+    // fila por baldes, e cada classe só percorre os vértices ainda não coloridos.
+    inline int rlf(const Graph &graph, std::vector<int> &colors)
+    {
+        const int n = graph.getNumVertices();
+        colors.assign(n, -1);
+        if (n == 0)
+            return 0;
+
+        enum : char
+        {
+            Colored,
+            Candidate,
+            Excluded
+        };
+        std::vector<char> state(n, Candidate);
+        std::vector<int> degreeInUncolored(n);   // vizinhos ainda não coloridos
+        std::vector<int> neighborsInExcluded(n); // vizinhos excluídos da classe atual
+        std::vector<int> uncolored(n);           // em ordem crescente de índice
+        for (int v = 0; v < n; ++v)
+        {
+            degreeInUncolored[v] = graph.degree(v);
+            uncolored[v] = v;
+        }
+
+        const int maxDegree = graph.degree(graph.getDegreeOrder()[0]);
+        const long long combinedKeys = static_cast<long long>(maxDegree + 1) * (maxDegree + 1);
+        const bool tieByDegree = combinedKeys <= 4LL * n + (1 << 20);
+        auto key = [&](int v)
+        {
+            return tieByDegree ? degreeInUncolored[v] - neighborsInExcluded[v] * (maxDegree + 1) : -neighborsInExcluded[v];
+        };
+
+        BucketQueue queue;
+        queue.reset(n, tieByDegree ? static_cast<int>(-combinedKeys) : -maxDegree, maxDegree);
+
+        int color = 0;
+        while (!uncolored.empty())
+        {
+            int v = -1;
+            size_t kept = 0;
+            for (int u : uncolored)
+            {
+                if (state[u] == Colored)
+                    continue;
+                uncolored[kept++] = u;
+                state[u] = Candidate;
+                neighborsInExcluded[u] = 0;
+                if (v == -1 || degreeInUncolored[u] > degreeInUncolored[v])
+                    v = u;
+            }
+            uncolored.resize(kept);
+            if (kept == 0)
+                break;
+
+            // Inserção em ordem decrescente de índice: o topo de cada balde (LIFO) é o menor
+            for (auto it = uncolored.rbegin(); it != uncolored.rend(); ++it)
+                queue.insert(*it, key(*it));
+
+            while (v != -1)
+            {
+                colors[v] = color;
+                state[v] = Colored;
+                queue.remove(v);
+
+                for (int u : graph.neighborsOf(v))
+                {
+                    --degreeInUncolored[u];
+                    if (state[u] != Candidate)
+                        continue;
+
+                    state[u] = Excluded;
+                    queue.remove(u);
+                    for (int w : graph.neighborsOf(u))
+                    {
+                        ++neighborsInExcluded[w];
+                        if (queue.contains(w))
+                            queue.update(w, key(w));
+                    }
+                }
+                if (tieByDegree)
+                {
+                    for (int u : graph.neighborsOf(v))
+                    {
+                        if (queue.contains(u))
+                            queue.update(u, key(u));
+                    }
+                }
+
+                v = queue.empty() ? -1 : queue.top();
+            }
+            ++color;
+        }
+        return color;
+    }
+
+    inline int color(InitialColoringStrategy strategy, const Graph &graph, std::vector<int> &colors)
+    {
+        switch (strategy)
+        {
+        case InitialColoringStrategy::DSatur:
+            return dsatur(graph, colors);
+        case InitialColoringStrategy::RLF:
+            return rlf(graph, colors);
+        default:
+            return greedy(graph, colors);
+        }
+    }
+}
+
+#endif // INITIAL_COLORING_H
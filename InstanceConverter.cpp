@@ -0,0 +1,47 @@
+#include <iostream>
+#include <string>
+#include "InstanceReader.h"
+#include "GraphCache.h"
+#include "MappedFile.h"
+
+// Converte instâncias DIMACS para o cache binário (<arquivo>.csr) lido pelo InstanceReader.
+// Uso: InstanceConverter <instancia> [<instancia> ...]
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "Uso: " << argv[0] << " <instancia> [<instancia> ...]\n";
+        return 1;
+    }
+
+    int failures = 0;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string inputFilename = argv[i];
+        try
+        {
+            InstanceReader reader(inputFilename, false, false);
+
+            MappedFile source(inputFilename);
+            uint64_t sourceHash = GraphCache::hashBytes(source.data(), source.size());
+            const std::string cacheFilename = GraphCache::cachePathFor(inputFilename);
+
+            if (!GraphCache::write(cacheFilename, reader.getGraph(), source.size(), sourceHash))
+            {
+                std::cerr << "Erro ao gravar " << cacheFilename << ".\n";
+                ++failures;
+                continue;
+            }
+
+            std::cout << inputFilename << " -> " << cacheFilename << " (" << reader.getNumVertices() << " vertices, "
+                      << reader.getNumEdges() << " arestas, " << reader.getLoadTimeMs() << " ms)\n";
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Erro ao ler " << inputFilename << ": " << e.what() << "\n";
+            ++failures;
+        }
+    }
+
+    return failures == 0 ? 0 : 1;
+}
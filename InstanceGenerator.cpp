@@ -0,0 +1,108 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <stdexcept>
+#include "GraphGenerator.h"
+#include "Checkpoint.h"
+
+// Gera instâncias sintéticas grandes em DIMACS, gravadas em fluxo (sem vetor de
+// arestas na memória), e opcionalmente o cache binário ao lado, que o
+// InstanceReader carrega direto.
+//
+// Uso: InstanceGenerator --model gnp|geometric|leighton|mycielski --output <arquivo> [opções]
+//   --vertices <n>     vértices (padrão 100000); mycielski: o maior nível com até n vértices
+//   --degree <d>       grau médio (padrão 10; ignorado no mycielski)
+//   --colors <k>       leighton: cores plantadas (padrão 10)
+//   --level <l>        mycielski: gera myciel<l> (χ = l + 1)
+//   --seed <s>         semente (padrão 1)
+//   --binary           grava também <arquivo>.csr
+//   --planted <arq>    leighton: grava a coloração plantada (serve de --warm-start no main)
+int main(int argc, char **argv)
+{
+    GeneratorSpec spec;
+    std::string outputPath;
+    std::string plantedPath;
+    bool binary = false;
+    try
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+            auto value = [&]() -> std::string
+            {
+                if (i + 1 >= argc)
+                    throw std::runtime_error("faltou o valor de " + arg);
+                return argv[++i];
+            };
+
+            if (arg == "--model")
+                spec.model = GeneratorSpec::parseModel(value());
+            else if (arg == "--output")
+                outputPath = value();
+            else if (arg == "--vertices")
+                spec.vertices = std::stoi(value());
+            else if (arg == "--degree")
+                spec.averageDegree = std::stod(value());
+            else if (arg == "--colors")
+                spec.colors = std::stoi(value());
+            else if (arg == "--level")
+                spec.level = std::stoi(value());
+            else if (arg == "--seed")
+                spec.seed = std::stoull(value());
+            else if (arg == "--binary")
+                binary = true;
+            else if (arg == "--planted")
+                plantedPath = value();
+            else
+                throw std::runtime_error("opção desconhecida: " + arg);
+        }
+        if (outputPath.empty())
+            throw std::runtime_error("faltou --output");
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Erro: " << e.what() << "\n";
+        std::cerr << "Uso: " << argv[0] << " --model gnp|geometric|leighton|mycielski --output <arquivo> [--vertices <n>] [--degree <d>] [--colors <k>] [--level <l>] [--seed <s>] [--binary] [--planted <arquivo>]\n";
+        return 1;
+    }
+
+    try
+    {
+        auto start = std::chrono::steady_clock::now();
+        auto secondsSince = [](std::chrono::steady_clock::time_point from)
+        {
+            return std::chrono::duration<double>(std::chrono::steady_clock::now() - from).count();
+        };
+
+        GraphGenerator generator(spec);
+        std::vector<int> degrees;
+        long long numEdges = generator.countEdges(binary ? &degrees : nullptr);
+        std::cout << generator.describe() << ": " << numEdges << " arestas (" << secondsSince(start) << " s)\n";
+
+        auto writeStart = std::chrono::steady_clock::now();
+        GraphGenerator::FileInfo info = generator.writeDimacs(outputPath, numEdges);
+        std::cout << outputPath << ": " << info.size << " bytes (" << secondsSince(writeStart) << " s)\n";
+
+        if (binary)
+        {
+            auto cacheStart = std::chrono::steady_clock::now();
+            generator.writeCache(outputPath, info, degrees);
+            std::cout << GraphCache::cachePathFor(outputPath) << " (" << secondsSince(cacheStart) << " s)\n";
+        }
+
+        if (!plantedPath.empty())
+        {
+            if (generator.plantedColoring().empty())
+                throw std::runtime_error("só o modelo leighton tem coloração plantada");
+            ColoringFile::write(plantedPath, generator.plantedColoring());
+            std::cout << plantedPath << ": coloração plantada com " << spec.colors << " cores\n";
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Erro: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
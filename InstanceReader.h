@@ -2,24 +2,47 @@
 #define INSTANCE_READER_H
 
 #include <iostream>
-#include <fstream>
-#include <sstream>
 #include <vector>
+#include <string>
+#include <utility>
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include "MappedFile.h"
+#include "Graph.h"
+#include "GraphCache.h"
 
+// Leitor de instâncias no formato DIMACS (.col/.txt). O arquivo é mapeado em
+// memória e os inteiros são lidos à mão, direto para um vetor de arestas
+// reservado a partir do cabeçalho "p edge" (limitado pelo tamanho do arquivo), e
+// então convertidos em um Graph
+// (base 0). Quando existe um cache binário (GraphCache) atualizado ao lado do
+// arquivo, o grafo é carregado dele sem nenhum parsing; caso contrário o texto é
+// lido e o cache é regravado. Linhas malformadas ou vértices fora de [1, n]
+// geram std::runtime_error.
 class InstanceReader
 {
 public:
-    InstanceReader(const std::string &filename)
+    InstanceReader(const std::string &filename, bool verbose = false, bool useCache = true)
     {
-        readFile(filename);
+        auto start = std::chrono::steady_clock::now();
+        readFile(filename, useCache);
+        loadTimeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        if (verbose)
+            printEdges();
     }
 
     void printEdges() const
     {
         std::cout << "Edges:\n";
-        for (const auto &edge : edges)
+        for (int u = 0; u < graph.getNumVertices(); ++u)
         {
-            std::cout << edge[0] << " -- " << edge[1] << "\n";
+            for (int v : graph.neighborsOf(u))
+            {
+                if (u < v)
+                    std::cout << u + 1 << " -- " << v + 1 << "\n";
+            }
         }
         std::cout << "Number of vertices: " << numVertices << "\n";
         std::cout << "Number of edges: " << numEdges << "\n";
@@ -27,50 +50,170 @@ public:
 
     int getNumVertices() const { return numVertices; }
     int getNumEdges() const { return numEdges; }
-    const std::vector<std::vector<int>> &getEdges() const { return edges; }
+    double getLoadTimeMs() const { return loadTimeMs; }
+    bool isFromCache() const { return fromCache; }
+    const Graph &getGraph() const { return graph; }
+    Graph takeGraph() { return std::move(graph); }
 
 private:
+    static constexpr size_t MIN_EDGE_LINE_BYTES = 6;
+
     int numVertices = 0;
     int numEdges = 0;
-    std::vector<std::vector<int>> edges;
+    double loadTimeMs = 0.0;
+    bool fromCache = false;
+    Graph graph;
+
+    std::string filename;
+    const char *cursor = nullptr;
+    const char *end = nullptr;
+    int lineNumber = 0;
 
-    void readFile(const std::string &filename)
+    void readFile(const std::string &path, bool useCache)
     {
-        std::ifstream file(filename);
-        std::string line;
+        filename = path;
+        MappedFile file(path);
 
-        if (!file.is_open())
+        if (!file.isOpen())
         {
-            std::cerr << "Could not open the file.\n";
-            return;
+            throw std::runtime_error("Could not open the file " + path + ".");
         }
 
-        while (std::getline(file, line))
+        uint64_t sourceHash = 0;
+        if (useCache)
+        {
+            sourceHash = GraphCache::hashBytes(file.data(), file.size());
+            if (GraphCache::load(GraphCache::cachePathFor(path), file.size(), sourceHash, graph))
+            {
+                fromCache = true;
+                numVertices = graph.getNumVertices();
+                numEdges = graph.getNumEdges();
+                return;
+            }
+        }
+
+        std::vector<std::pair<int, int>> edges;
+        cursor = file.data();
+        end = cursor + file.size();
+        bool hasHeader = false;
+
+        while (cursor < end)
         {
-            if (line.empty() || line[0] == 'c')
+            ++lineNumber;
+            skipSpaces();
+
+            char type = cursor < end ? *cursor : '\n';
+            if (type == '\n' || type == '\r' || type == 'c')
             {
-                continue; // Ignora linhas comentadas.
+                skipLine(); // Ignora linhas vazias e comentadas.
+                continue;
             }
+            ++cursor;
 
-            if (line[0] == 'p')
+            if (type == 'p')
             {
-                std::istringstream ss(line);
-                char p;
-                std::string text;
-                ss >> p >> text >> numVertices >> numEdges;
+                if (hasHeader)
+                    fail("duplicate 'p' line");
+
+                skipSpaces();
+                while (cursor < end && *cursor != ' ' && *cursor != '\t' && *cursor != '\n' && *cursor != '\r')
+                    ++cursor; // Formato ("edge" ou "col")
+
+                numVertices = parseInt();
+                numEdges = parseInt();
+                if (numVertices < 0 || numEdges < 0)
+                    fail("negative size in 'p' line");
+
+                // A reserva não passa do que o resto do arquivo comporta ("e 1 2\n" tem ao
+                // menos 6 bytes): um 'p' com contagem absurda não aloca nada antes das arestas
+                const size_t maxEdgeLines = static_cast<size_t>(end - cursor) / MIN_EDGE_LINE_BYTES + 1;
+                edges.reserve(std::min(static_cast<size_t>(numEdges), maxEdgeLines));
+                hasHeader = true;
             }
-            else if (line[0] == 'e')
+            else if (type == 'e')
             {
-                std::istringstream ss(line);
-                char e;
-                int v1, v2;
-                ss >> e >> v1 >> v2;       // Ignora o 'e' e lê os dois números
-                edges.push_back({v1, v2}); // Armazena o par de vértices em edges
+                if (!hasHeader)
+                    fail("'e' line before 'p' line");
+
+                int v1 = parseInt();
+                int v2 = parseInt();
+                if (v1 < 1 || v1 > numVertices || v2 < 1 || v2 > numVertices)
+                    fail("vertex out of range [1, " + std::to_string(numVertices) + "]");
+                if (edges.size() == static_cast<size_t>(numEdges))
+                    fail("more edges than declared in the 'p' line");
+
+                edges.emplace_back(v1 - 1, v2 - 1);
             }
+            else
+            {
+                fail(std::string("unknown line type '") + type + "'");
+            }
+
+            expectEndOfLine();
         }
 
-        file.close();
-        printEdges();
+        if (!hasHeader)
+            fail("missing 'p' line");
+
+        cursor = end = nullptr;
+
+        graph = Graph(numVertices, edges);
+        numEdges = graph.getNumEdges();
+
+        if (useCache)
+        {
+            GraphCache::write(GraphCache::cachePathFor(path), graph, file.size(), sourceHash);
+        }
+    }
+
+    [[noreturn]] void fail(const std::string &message) const
+    {
+        throw std::runtime_error(filename + ":" + std::to_string(lineNumber) + ": " + message);
+    }
+
+    void skipSpaces()
+    {
+        while (cursor < end && (*cursor == ' ' || *cursor == '\t'))
+            ++cursor;
+    }
+
+    void skipLine()
+    {
+        while (cursor < end && *cursor != '\n')
+            ++cursor;
+        if (cursor < end)
+            ++cursor;
+    }
+
+    void expectEndOfLine()
+    {
+        skipSpaces();
+        if (cursor < end && *cursor == '\r')
+            ++cursor;
+        if (cursor < end && *cursor != '\n')
+            fail("unexpected trailing characters");
+        if (cursor < end)
+            ++cursor;
+    }
+
+    int parseInt()
+    {
+        skipSpaces();
+        bool negative = cursor < end && *cursor == '-';
+        if (negative)
+            ++cursor;
+        if (cursor == end || *cursor < '0' || *cursor > '9')
+            fail("expected an integer");
+
+        long long value = 0;
+        while (cursor < end && *cursor >= '0' && *cursor <= '9')
+        {
+            value = value * 10 + (*cursor - '0');
+            if (value > 2147483647LL)
+                fail("integer out of range");
+            ++cursor;
+        }
+        return static_cast<int>(negative ? -value : value);
     }
 };
 
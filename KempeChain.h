@@ -0,0 +1,105 @@
+#ifndef KEMPE_CHAIN_H
+#define KEMPE_CHAIN_H
+
+#include <vector>
+#include <algorithm>
+#include "Graph.h"
+#include "ConflictTable.h"
+#include "Move.h"
+
+// Cadeias de Kempe: a cadeia K(v, a, b), com a = cor de v, é a componente de v no
+// subgrafo induzido pelas cores a e b. Trocar a e b na cadeia não muda nenhuma
+// colisão (as arestas internas seguem com ou sem conflito, e nenhum vértice de fora
+// tem vizinho de cor a ou b nela), só os tamanhos das duas classes, e o custo só
+// cai quando a maior classe se esvazia: o delta sai dos vértices de cada cor
+// contados na busca, sem aplicar a troca.
+//
+// A busca é em largura, com o próprio vetor da cadeia como fila, e os visitados são
+// marcados por época num vetor reaproveitado: começar uma cadeia nova é incrementar
+// a época, sem limpar nem alocar n posições por movimento.
+class KempeChains
+{
+public:
+    void reset(int n)
+    {
+        stamp.assign(n, 0);
+        epoch = 0;
+        chain.clear();
+        chain.reserve(n);
+    }
+
+    // Monta a cadeia de v entre a sua cor e b (b diferente da cor de v), pelas cores da tabela.
+    void extract(const Graph &graph, const ConflictTable &conflicts, int v, int b)
+    {
+        const std::vector<int> &colors = conflicts.getColors();
+        nextEpoch();
+        colorA = colors[v];
+        colorB = b;
+        countA = 0;
+
+        chain.clear();
+        chain.push_back(v);
+        stamp[v] = epoch;
+        for (size_t head = 0; head < chain.size(); ++head)
+        {
+            int x = chain[head];
+            countA += colors[x] == colorA;
+            for (int u : graph.neighborsOf(x))
+            {
+                if (stamp[u] != epoch && (colors[u] == colorA || colors[u] == colorB))
+                {
+                    stamp[u] = epoch;
+                    chain.push_back(u);
+                }
+            }
+        }
+    }
+
+    const std::vector<int> &vertices() const { return chain; }
+    int getColorA() const { return colorA; }
+    int getColorB() const { return colorB; }
+
+    // Tamanho da classe c depois da troca da última cadeia extraída.
+    int classSizeAfterSwap(const ConflictTable &conflicts, int c) const
+    {
+        int size = conflicts.colorClassSize(c);
+        int countB = static_cast<int>(chain.size()) - countA;
+        if (c == colorA)
+            return size - countA + countB;
+        if (c == colorB)
+            return size - countB + countA;
+        return size;
+    }
+
+    // Acrescenta a troca ao movimento: cor a vira b e vice-versa.
+    void addSwap(Move &move, const ConflictTable &conflicts) const
+    {
+        for (int v : chain)
+            move.add(v, conflicts.color(v) == colorA ? colorB : colorA);
+    }
+
+    void applySwap(ConflictTable &conflicts) const
+    {
+        for (int v : chain)
+            conflicts.recolor(v, conflicts.color(v) == colorA ? colorB : colorA);
+    }
+
+private:
+    std::vector<unsigned> stamp; // época em que cada vértice entrou numa cadeia
+    unsigned epoch = 0;
+    std::vector<int> chain; // vértices da cadeia em ordem de visita (também a fila)
+    int colorA = -1;
+    int colorB = -1;
+    int countA = 0; // vértices de cor a na cadeia; os demais têm cor b
+
+    void nextEpoch()
+    {
+        if (++epoch == 0)
+        {
+            std::fill(stamp.begin(), stamp.end(), 0);
+            epoch = 1;
+        }
+    }
+};
+
+#endif // KEMPE_CHAIN_H
@@ -0,0 +1,111 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <string>
+#include <cstddef>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Arquivo mapeado em memória somente para leitura. O conteúdo fica acessível
+// por data()/size() enquanto o objeto existir, sem cópia para o heap.
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::string &filename) { open(filename); }
+
+    ~MappedFile() { close(); }
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    bool isOpen() const { return opened; }
+    const char *data() const { return static_cast<const char *>(view); }
+    size_t size() const { return length; }
+
+private:
+    bool opened = false;
+    const void *view = nullptr;
+    size_t length = 0;
+
+#ifdef _WIN32
+    HANDLE fileHandle = INVALID_HANDLE_VALUE;
+    HANDLE mappingHandle = nullptr;
+
+    void open(const std::string &filename)
+    {
+        fileHandle = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                 FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+            return;
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(fileHandle, &fileSize))
+            return;
+        length = static_cast<size_t>(fileSize.QuadPart);
+        opened = true;
+        if (length == 0)
+            return;
+
+        mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mappingHandle != nullptr)
+            view = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+        opened = view != nullptr;
+    }
+
+    void close()
+    {
+        if (view != nullptr)
+            UnmapViewOfFile(view);
+        if (mappingHandle != nullptr)
+            CloseHandle(mappingHandle);
+        if (fileHandle != INVALID_HANDLE_VALUE)
+            CloseHandle(fileHandle);
+    }
+#else
+    void open(const std::string &filename)
+    {
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+            return;
+
+        struct stat info;
+        if (fstat(fd, &info) == 0)
+        {
+            length = static_cast<size_t>(info.st_size);
+            opened = true;
+            if (length > 0)
+            {
+                void *mapped = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (mapped == MAP_FAILED)
+                {
+                    opened = false;
+                }
+                else
+                {
+                    madvise(mapped, length, MADV_SEQUENTIAL);
+                    view = mapped;
+                }
+            }
+        }
+        ::close(fd);
+    }
+
+    void close()
+    {
+        if (view != nullptr)
+            munmap(const_cast<void *>(view), length);
+    }
+#endif
+};
+
+#endif // MAPPED_FILE_H
@@ -0,0 +1,65 @@
+#ifndef MOVE_H
+#define MOVE_H
+
+#include <vector>
+#include "ConflictTable.h"
+
+// Movimento de vizinhança: uma lista de recolorações (vértice, cor antiga, cor
+// nova) aplicada e desfeita no lugar sobre a ConflictTable. Um recolorir simples
+// tem uma entrada; movimentos de cluster têm várias. A capacidade do vetor é
+// reaproveitada entre iterações, então não há alocação no laço principal.
+class Move
+{
+public:
+    struct Recolor
+    {
+        int vertex;
+        int oldColor;
+        int newColor;
+    };
+
+    void reserve(int capacity) { recolors.reserve(capacity); }
+
+    void clear()
+    {
+        recolors.clear();
+        applied = false;
+    }
+
+    bool empty() const { return recolors.empty(); }
+    int size() const { return static_cast<int>(recolors.size()); }
+    const Recolor &operator[](int i) const { return recolors[i]; }
+
+    void add(int vertex, int newColor)
+    {
+        recolors.push_back({vertex, -1, newColor});
+    }
+
+    void apply(ConflictTable &conflicts)
+    {
+        for (auto &recolor : recolors)
+        {
+            recolor.oldColor = conflicts.color(recolor.vertex);
+            conflicts.recolor(recolor.vertex, recolor.newColor);
+        }
+        applied = true;
+    }
+
+    // Desfaz em ordem inversa, restaurando exatamente o estado anterior ao apply.
+    void revert(ConflictTable &conflicts)
+    {
+        if (!applied)
+            return;
+        for (auto it = recolors.rbegin(); it != recolors.rend(); ++it)
+        {
+            conflicts.recolor(it->vertex, it->oldColor);
+        }
+        applied = false;
+    }
+
+private:
+    std::vector<Recolor> recolors;
+    bool applied = false;
+};
+
+#endif // MOVE_H
@@ -0,0 +1,221 @@
+#ifndef NEIGHBORHOOD_POLICIES_H
+#define NEIGHBORHOOD_POLICIES_H
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include "Graph.h"
+#include "ConflictTable.h"
+#include "Move.h"
+#include "Random.h"
+#include "KempeChain.h"
+
+// Políticas resolvidas em tempo de compilação pelos solvers. Cada combinação
+// (vizinhança x aceitação, ou vizinhança x melhoria na busca local) gera o seu
+// próprio laço principal, sem desvio por inteiro nem chamada indireta a cada
+// iteração. A escolha em tempo de execução passa por dispatchPolicy sobre as
+// listas abaixo: uma vizinhança nova é uma struct com `id`, `keepsCollisions` e
+// generate(), acrescentada a AnnealingNeighborhoods, sem mexer no solver.
+
+// Estado que as vizinhanças da têmpera simulada leem para montar um movimento.
+struct MoveContext
+{
+    const Graph &graph;
+    const ConflictTable &conflicts;
+    Xoshiro256 &rng;
+    int numColors;                  // cores da coloração inicial; fixo durante a busca
+    std::vector<char> &colorsUsed;  // rascunho com numColors + 1 posições
+    KempeChains &kempe;             // rascunho das cadeias de Kempe (vizinho 4)
+};
+
+namespace Neighborhoods
+{
+    // Vizinho 1: recolore a componente conexa de um vértice sorteado com as cores que
+    // ela ainda não usa; quando as livres acabam, o resto recebe numColors.
+    struct ClusterRecolor
+    {
+        static constexpr int id = 1;
+        static constexpr bool keepsCollisions = true; // nunca aceita mais colisões que a atual
+
+        static void generate(MoveContext &context, Move &move)
+        {
+            const std::vector<int> &current = context.conflicts.getColors();
+            int startVertex = context.rng.nextInt(context.graph.getNumVertices());
+
+            const GraphComponents &components = context.graph.getComponents();
+            auto cluster = components.verticesOf(components.componentOf(startVertex));
+
+            std::vector<char> &colorsUsed = context.colorsUsed;
+            std::fill(colorsUsed.begin(), colorsUsed.end(), 0);
+            for (int v : cluster)
+            {
+                if (current[v] != -1)
+                    colorsUsed[current[v]] = 1;
+            }
+
+            int newColor = 0;
+            for (int v : cluster)
+            {
+                while (newColor < context.numColors && colorsUsed[newColor])
+                    ++newColor;
+                move.add(v, newColor);
+                colorsUsed[newColor] = 1;
+            }
+        }
+    };
+
+    // Vizinho 2: de dois vértices sorteados, o de cor maior passa para a cor do outro,
+    // se ela estiver livre na sua vizinhança.
+    struct LowerColorSwap
+    {
+        static constexpr int id = 2;
+        static constexpr bool keepsCollisions = false;
+
+        static void generate(MoveContext &context, Move &move)
+        {
+            const std::vector<int> &current = context.conflicts.getColors();
+            int n = context.graph.getNumVertices();
+            int v1 = context.rng.nextInt(n);
+            int v2 = context.rng.nextInt(n);
+            if (v1 == v2)
+                return;
+
+            int higherColorVertex = (current[v1] > current[v2]) ? v1 : v2;
+            int lowerColorVertex = (higherColorVertex == v1) ? v2 : v1;
+            if (context.conflicts.canColor(higherColorVertex, current[lowerColorVertex]))
+                move.add(higherColorVertex, current[lowerColorVertex]);
+        }
+    };
+
+    // Vizinho 3: metade das vezes um vértice sorteado vai para a menor cor livre,
+    // na outra metade é o vizinho 2.
+    struct FirstFreeOrSwap
+    {
+        static constexpr int id = 3;
+        static constexpr bool keepsCollisions = false;
+
+        static void generate(MoveContext &context, Move &move)
+        {
+            if (context.rng.nextInt(2) != 0)
+            {
+                LowerColorSwap::generate(context, move);
+                return;
+            }
+
+            int v = context.rng.nextInt(context.graph.getNumVertices());
+            for (int c = 0; c < context.numColors; ++c)
+            {
+                if (context.conflicts.canColor(v, c))
+                {
+                    move.add(v, c);
+                    break;
+                }
+            }
+        }
+    };
+
+    // Vizinho 4: troca as duas cores de uma cadeia de Kempe. O vértice de partida é
+    // procurado na maior classe de cor (por algumas tentativas) e a outra cor é
+    // sorteada entre as usadas. A troca não muda colisões e nunca piora o custo, que
+    // só cai quando esvazia a maior classe; por isso trocas que fariam essa classe
+    // crescer viram movimento vazio, e a busca anda no platô em direção a esvaziá-la.
+    struct KempeSwap
+    {
+        static constexpr int id = 4;
+        static constexpr bool keepsCollisions = false;
+        static constexpr int TOP_CLASS_PROBES = 32;
+
+        static void generate(MoveContext &context, Move &move)
+        {
+            const ConflictTable &conflicts = context.conflicts;
+            int n = context.graph.getNumVertices();
+            int top = conflicts.cost() - 1;
+            if (top <= 0)
+                return;
+
+            int v = context.rng.nextInt(n);
+            for (int probe = 1; probe < TOP_CLASS_PROBES && conflicts.color(v) != top; ++probe)
+                v = context.rng.nextInt(n);
+            int a = conflicts.color(v);
+            if (a < 0)
+                return;
+            int b = context.rng.nextInt(top); // uma das cores 0..top, exceto a
+            if (b >= a)
+                ++b;
+
+            context.kempe.extract(context.graph, conflicts, v, b);
+            if (context.kempe.classSizeAfterSwap(conflicts, top) > conflicts.colorClassSize(top))
+                return;
+            context.kempe.addSwap(move, conflicts);
+        }
+    };
+}
+
+enum class AcceptanceRule
+{
+    Metropolis,
+    Threshold
+};
+
+namespace Acceptance
+{
+    // Critério de Metropolis: piora de delta aceita com probabilidade exp(-delta / T).
+    struct Metropolis
+    {
+        static constexpr AcceptanceRule id = AcceptanceRule::Metropolis;
+
+        static bool accept(int currentCost, int newCost, double temperature, Xoshiro256 &rng)
+        {
+            if (temperature <= 0)
+                return false;
+            double probability = std::exp((currentCost - newCost) / temperature);
+            return rng.nextDouble() < probability;
+        }
+    };
+
+    // Threshold accepting: aceita, sem sorteio, toda piora de até T.
+    struct Threshold
+    {
+        static constexpr AcceptanceRule id = AcceptanceRule::Threshold;
+
+        static bool accept(int currentCost, int newCost, double temperature, Xoshiro256 &)
+        {
+            return newCost - currentCost <= temperature;
+        }
+    };
+}
+
+// Regras de melhoria da busca local.
+struct FirstImprovement
+{
+    static constexpr bool stopAtFirst = true;
+};
+
+struct BestImprovement
+{
+    static constexpr bool stopAtFirst = false;
+};
+
+template <typename... Policies>
+struct PolicyList
+{
+};
+
+using AnnealingNeighborhoods = PolicyList<Neighborhoods::ClusterRecolor, Neighborhoods::LowerColorSwap, Neighborhoods::FirstFreeOrSwap, Neighborhoods::KempeSwap>;
+using AcceptanceRules = PolicyList<Acceptance::Metropolis, Acceptance::Threshold>;
+
+// Chama body(Policy{}) para a política da lista cujo id é `id`; false se nenhuma tiver esse id.
+template <typename... Policies, typename Id, typename Body>
+bool dispatchPolicy(PolicyList<Policies...>, Id id, Body &&body)
+{
+    return ((Policies::id == id ? (body(Policies{}), true) : false) || ...);
+}
+
+// Ids das políticas da lista, na ordem da lista.
+template <typename... Policies>
+std::vector<int> policyIds(PolicyList<Policies...>)
+{
+    return {static_cast<int>(Policies::id)...};
+}
+
+#endif // NEIGHBORHOOD_POLICIES_H
@@ -0,0 +1,87 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <cstdint>
+#include <random>
+
+// SplitMix64: usado para expandir uma semente em estados/sementes independentes.
+inline uint64_t splitMix64(uint64_t &state)
+{
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Gerador xoshiro256** (Blackman e Vigna). Rápido, com estado próprio por
+// instância, de modo que cada thread/cadeia tem sua sequência independente.
+class Xoshiro256
+{
+public:
+    explicit Xoshiro256(uint64_t seed = randomSeed()) { reseed(seed); }
+
+    static uint64_t randomSeed()
+    {
+        std::random_device device;
+        return (static_cast<uint64_t>(device()) << 32) ^ device();
+    }
+
+    // Sementes reprodutíveis para várias cadeias a partir de uma semente mestre.
+    static uint64_t deriveSeed(uint64_t masterSeed, uint64_t index)
+    {
+        uint64_t state = masterSeed ^ (index * 0xD1B54A32D192ED03ULL);
+        splitMix64(state);
+        return splitMix64(state);
+    }
+
+    void reseed(uint64_t seed)
+    {
+        uint64_t state = seed;
+        for (auto &word : s)
+            word = splitMix64(state);
+    }
+
+    uint64_t next()
+    {
+        const uint64_t result = rotl(s[1] * 5, 7) * 9;
+        const uint64_t t = s[1] << 17;
+
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 45);
+
+        return result;
+    }
+
+    // Inteiro uniforme em [0, bound), pela multiplicação de Lemire.
+    int nextInt(int bound)
+    {
+        return static_cast<int>(((next() >> 32) * static_cast<uint64_t>(bound)) >> 32);
+    }
+
+    // Real uniforme em [0, 1).
+    double nextDouble()
+    {
+        return static_cast<double>(next() >> 11) * 0x1.0p-53;
+    }
+
+    const uint64_t *state() const { return s; }
+    void setState(const uint64_t newState[4])
+    {
+        for (int i = 0; i < 4; ++i)
+            s[i] = newState[i];
+    }
+
+private:
+    uint64_t s[4];
+
+    static uint64_t rotl(uint64_t x, int k)
+    {
+        return (x << k) | (x >> (64 - k));
+    }
+};
+
+#endif // RANDOM_H
@@ -0,0 +1,237 @@
+#ifndef RESULT_WRITER_H
+#define RESULT_WRITER_H
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "TextFormat.h"
+
+// Um registro por execução (instância, algoritmo, vizinhança, semente).
+struct RunRecord
+{
+    std::string instance;
+    std::string algorithm;
+    std::string neighborhood; // vazio quando o algoritmo não tem vizinhanças
+    uint64_t seed = 0;
+    double wallMs = 0;
+    long long iterations = 0;
+    int colors = 0;
+    int conflicts = 0;
+    std::string stopReason;
+    int lowerBound = 0; // 0 = desconhecido
+    const std::vector<int> *coloring = nullptr; // gravada no arquivo lateral, se houver
+};
+
+// Grava os registros em JSONL ou CSV (pela extensão do arquivo) e, opcionalmente,
+// as colorações finais num arquivo binário lateral; o registro guarda o deslocamento
+// (colors_offset) do bloco da sua coloração, ou -1. Pode ser compartilhado entre
+// threads: cada registro é formatado fora da trava e acumulado num buffer, que só
+// vai para o disco ao passar de FLUSH_BYTES ou em flush().
+//
+// Arquivo de cores (inteiros na ordem de bytes nativa):
+//   char magic[8] = "GCOLCLR", uint32 version, uint32 reservado
+//   por bloco: uint32 numVertices, uint8 bytesPorCor (1, 2 ou 4), 3 bytes de
+//   preenchimento, cores[numVertices] com a largura indicada
+class ResultWriter
+{
+public:
+    static constexpr size_t FLUSH_BYTES = 1 << 16;
+
+    using Format = TextFormat::Format;
+
+    explicit ResultWriter(const std::string &path, const std::string &colorsPath = "")
+        : format(TextFormat::formatFor(path)), out(path, std::ios::trunc)
+    {
+        if (!out.is_open())
+            throw std::runtime_error(path + ": não foi possível abrir o arquivo de resultados");
+        if (format == Format::Csv)
+            buffer = "instance,algorithm,neighborhood,seed,wall_ms,iterations,colors,conflicts,lower_bound,gap,stop_reason,colors_offset\n";
+
+        if (!colorsPath.empty())
+        {
+            colorsOut.open(colorsPath, std::ios::binary | std::ios::trunc);
+            if (!colorsOut.is_open())
+                throw std::runtime_error(colorsPath + ": não foi possível abrir o arquivo de cores");
+            char header[16] = {};
+            std::memcpy(header, COLORS_MAGIC, sizeof(COLORS_MAGIC));
+            std::memcpy(header + 8, &COLORS_VERSION, sizeof(COLORS_VERSION));
+            colorsBuffer.assign(header, header + sizeof(header));
+        }
+    }
+
+    ~ResultWriter()
+    {
+        flush();
+    }
+
+    void write(const RunRecord &record)
+    {
+        std::string block;
+        if (colorsOut.is_open() && record.coloring != nullptr)
+            block = encodeColoring(*record.coloring);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        long long offset = -1;
+        if (!block.empty())
+        {
+            offset = static_cast<long long>(colorsWritten + colorsBuffer.size());
+            colorsBuffer += block;
+        }
+        buffer += format == Format::Csv ? formatCsv(record, offset) : formatJson(record, offset);
+
+        if (buffer.size() >= FLUSH_BYTES || colorsBuffer.size() >= FLUSH_BYTES)
+            flushLocked();
+    }
+
+    void flush()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        flushLocked();
+    }
+
+    // Lê a coloração gravada em `offset` de um arquivo de cores.
+    static std::vector<int> readColoring(const std::string &colorsPath, long long offset)
+    {
+        std::ifstream in(colorsPath, std::ios::binary);
+        char header[16];
+        if (!in.read(header, sizeof(header)) || std::memcmp(header, COLORS_MAGIC, sizeof(COLORS_MAGIC)) != 0)
+            throw std::runtime_error(colorsPath + ": arquivo de cores inválido");
+
+        in.seekg(offset);
+        return decodeColoring(in, colorsPath + " (deslocamento " + std::to_string(offset) + ")");
+    }
+
+    // Um bloco de coloração no formato do arquivo de cores (também usado pelos checkpoints).
+    static std::string encodeColoring(const std::vector<int> &coloring)
+    {
+        int maxColor = coloring.empty() ? 0 : *std::max_element(coloring.begin(), coloring.end());
+        unsigned char width = maxColor < (1 << 8) ? 1 : maxColor < (1 << 16) ? 2 : 4;
+        uint32_t numVertices = static_cast<uint32_t>(coloring.size());
+
+        std::string block(8 + coloring.size() * width, '\0');
+        std::memcpy(&block[0], &numVertices, sizeof(numVertices));
+        block[4] = static_cast<char>(width);
+        char *data = &block[8];
+        for (size_t v = 0; v < coloring.size(); ++v)
+        {
+            if (width == 1)
+                data[v] = static_cast<char>(coloring[v]);
+            else if (width == 2)
+            {
+                uint16_t c = static_cast<uint16_t>(coloring[v]);
+                std::memcpy(data + v * 2, &c, 2);
+            }
+            else
+            {
+                int32_t c = coloring[v];
+                std::memcpy(data + v * 4, &c, 4);
+            }
+        }
+        return block;
+    }
+
+    // Lê o bloco que começa na posição atual de `in`; `source` identifica o bloco nas mensagens de erro.
+    static std::vector<int> decodeColoring(std::istream &in, const std::string &source)
+    {
+        uint32_t numVertices = 0;
+        unsigned char blockHeader[8];
+        if (!in.read(reinterpret_cast<char *>(blockHeader), sizeof(blockHeader)))
+            throw std::runtime_error(source + ": bloco de cores fora do arquivo");
+        std::memcpy(&numVertices, blockHeader, sizeof(numVertices));
+        int width = blockHeader[4];
+        if (width != 1 && width != 2 && width != 4)
+            throw std::runtime_error(source + ": bloco de cores inválido");
+
+        std::vector<char> data(static_cast<size_t>(numVertices) * width);
+        if (!in.read(data.data(), static_cast<std::streamsize>(data.size())))
+            throw std::runtime_error(source + ": bloco de cores truncado");
+
+        std::vector<int> coloring(numVertices);
+        for (uint32_t v = 0; v < numVertices; ++v)
+        {
+            if (width == 1)
+                coloring[v] = static_cast<unsigned char>(data[v]);
+            else if (width == 2)
+            {
+                uint16_t c;
+                std::memcpy(&c, &data[static_cast<size_t>(v) * 2], 2);
+                coloring[v] = c;
+            }
+            else
+            {
+                int32_t c;
+                std::memcpy(&c, &data[static_cast<size_t>(v) * 4], 4);
+                coloring[v] = c;
+            }
+        }
+        return coloring;
+    }
+
+    static bool isColorsFile(const std::string &path)
+    {
+        std::ifstream in(path, std::ios::binary);
+        char magic[8];
+        return in.read(magic, sizeof(magic)) && std::memcmp(magic, COLORS_MAGIC, sizeof(COLORS_MAGIC)) == 0;
+    }
+
+private:
+    static constexpr char COLORS_MAGIC[8] = {'G', 'C', 'O', 'L', 'C', 'L', 'R', '\0'};
+    static constexpr uint32_t COLORS_VERSION = 1;
+
+    Format format;
+    std::ofstream out;
+    std::ofstream colorsOut;
+    std::string buffer;
+    std::string colorsBuffer;
+    uint64_t colorsWritten = 0;
+    std::mutex mutex;
+
+    void flushLocked()
+    {
+        out << buffer;
+        out.flush();
+        buffer.clear();
+        if (colorsOut.is_open())
+        {
+            colorsOut.write(colorsBuffer.data(), static_cast<std::streamsize>(colorsBuffer.size()));
+            colorsOut.flush();
+            colorsWritten += colorsBuffer.size();
+            colorsBuffer.clear();
+        }
+    }
+
+    // Gap de otimalidade (cores - limite inferior) de uma coloração legal; -1 se não se aplica.
+    static int gapOf(const RunRecord &r)
+    {
+        return r.lowerBound > 0 && r.conflicts == 0 ? r.colors - r.lowerBound : -1;
+    }
+
+    static std::string formatJson(const RunRecord &r, long long offset)
+    {
+        std::ostringstream line;
+        line << "{\"instance\":\"" << TextFormat::escapeJson(r.instance) << "\",\"algorithm\":\"" << TextFormat::escapeJson(r.algorithm)
+             << "\",\"neighborhood\":\"" << TextFormat::escapeJson(r.neighborhood) << "\",\"seed\":" << r.seed
+             << ",\"wallMs\":" << r.wallMs << ",\"iterations\":" << r.iterations << ",\"colors\":" << r.colors
+             << ",\"conflicts\":" << r.conflicts << ",\"lowerBound\":" << r.lowerBound << ",\"gap\":" << gapOf(r)
+             << ",\"stopReason\":\"" << TextFormat::escapeJson(r.stopReason)
+             << "\",\"colorsOffset\":" << offset << "}\n";
+        return line.str();
+    }
+
+    static std::string formatCsv(const RunRecord &r, long long offset)
+    {
+        std::ostringstream line;
+        line << TextFormat::quoteCsv(r.instance) << ',' << TextFormat::quoteCsv(r.algorithm) << ',' << TextFormat::quoteCsv(r.neighborhood) << ','
+             << r.seed << ',' << r.wallMs << ',' << r.iterations << ',' << r.colors << ',' << r.conflicts << ','
+             << r.lowerBound << ',' << gapOf(r) << ',' << TextFormat::quoteCsv(r.stopReason) << ',' << offset << '\n';
+        return line.str();
+    }
+};
+
+#endif // RESULT_WRITER_H
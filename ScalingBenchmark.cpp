@@ -0,0 +1,348 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <stdexcept>
+#include "GraphGenerator.h"
+#include "InstanceReader.h"
+#include "Graph.h"
+#include "GraphColoring_LocalSearch.h"
+#include "GraphColoring_SimulatedAnnealing.h"
+#include "GraphColoring_TabuCol.h"
+#include "AnnealingSchedule.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+// Escalabilidade em grafos sintéticos: para cada modelo e tamanho, gera a
+// instância (InstanceGenerator), lê com o InstanceReader (parse do DIMACS e
+// cache binário) e roda os solvers com tempo limite, medindo tempo e pico de
+// memória de cada fase.
+//
+// Uso: ScalingBenchmark [opções]
+//   --models <lista>        modelos separados por vírgula (padrão gnp,geometric,leighton,mycielski)
+//   --sizes <lista>         vértices separados por vírgula (padrão 100000,1000000)
+//   --degree <d>            grau médio (padrão 10)
+//   --colors <k>            cores plantadas no leighton (padrão 10)
+//   --time-limit <s>        tempo de cada solver (padrão 5)
+//   --neighborhood <1-4>    vizinhança da têmpera (padrão 2; a 1 recolore componentes inteiras)
+//   --seed <s>              semente (padrão 20250119)
+//   --dir <diretório>       onde gravar as instâncias (padrão: temporário do sistema)
+//   --keep                  não apaga as instâncias geradas
+//   --save <arquivo.csv>    grava as medições
+//
+// O pico de memória de cada fase só é separado no Linux (VmHWM zerado por
+// /proc/self/clear_refs); nos outros sistemas a coluna mostra o pico do processo.
+
+struct ScalingOptions
+{
+    std::vector<GeneratorModel> models = {GeneratorModel::Random, GeneratorModel::Geometric, GeneratorModel::Leighton, GeneratorModel::Mycielski};
+    std::vector<int> sizes = {100000, 1000000};
+    double averageDegree = 10.0;
+    int colors = 10;
+    double timeLimit = 5.0;
+    int neighborhood = 2;
+    uint64_t seed = 20250119;
+    std::string directory;
+    bool keep = false;
+    std::string savePath;
+};
+
+struct PhaseSample
+{
+    std::string model;
+    int vertices = 0;
+    long long edges = 0;
+    std::string phase;
+    double wallMs = 0;
+    double peakMb = 0;
+    int colors = 0;    // só nas fases de solver
+    int conflicts = 0; // idem
+};
+
+// Zera o pico de memória residente do processo, onde o sistema permite.
+void resetPeakMemory()
+{
+#ifdef __linux__
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    clearRefs << "5";
+#endif
+}
+
+// Pico de memória residente em MB desde resetPeakMemory() (Linux) ou desde o início.
+double peakMemoryMb()
+{
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (line.compare(0, 6, "VmHWM:") == 0)
+            return std::stod(line.substr(6)) / 1024.0;
+    }
+    return 0;
+#elif defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return 0;
+    return counters.PeakWorkingSetSize / (1024.0 * 1024.0);
+#else
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return usage.ru_maxrss / (1024.0 * 1024.0);
+#else
+    return usage.ru_maxrss / 1024.0;
+#endif
+#endif
+}
+
+template <typename Body>
+double measureMs(Body body)
+{
+    auto start = std::chrono::steady_clock::now();
+    body();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+template <typename T, typename Parse>
+std::vector<T> parseList(const std::string &text, Parse parse)
+{
+    std::vector<T> values;
+    std::stringstream items(text);
+    std::string item;
+    while (std::getline(items, item, ','))
+    {
+        if (!item.empty())
+            values.push_back(parse(item));
+    }
+    return values;
+}
+
+ScalingOptions parseOptions(int argc, char **argv)
+{
+    ScalingOptions options;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        auto value = [&]() -> std::string
+        {
+            if (i + 1 >= argc)
+                throw std::runtime_error("faltou o valor de " + arg);
+            return argv[++i];
+        };
+
+        if (arg == "--models")
+            options.models = parseList<GeneratorModel>(value(), GeneratorSpec::parseModel);
+        else if (arg == "--sizes")
+            options.sizes = parseList<int>(value(), [](const std::string &item)
+                                           { return std::stoi(item); });
+        else if (arg == "--degree")
+            options.averageDegree = std::stod(value());
+        else if (arg == "--colors")
+            options.colors = std::stoi(value());
+        else if (arg == "--time-limit")
+            options.timeLimit = std::stod(value());
+        else if (arg == "--neighborhood")
+            options.neighborhood = std::stoi(value());
+        else if (arg == "--seed")
+            options.seed = std::stoull(value());
+        else if (arg == "--dir")
+            options.directory = value();
+        else if (arg == "--keep")
+            options.keep = true;
+        else if (arg == "--save")
+            options.savePath = value();
+        else
+            throw std::runtime_error("opção desconhecida: " + arg);
+    }
+
+    if (options.directory.empty())
+        options.directory = (std::filesystem::temp_directory_path() / "gcol_scaling").string();
+    std::filesystem::create_directories(options.directory);
+    return options;
+}
+
+void printSample(const PhaseSample &sample)
+{
+    std::cout << std::left << std::setw(11) << sample.model << std::right << std::setw(10) << sample.vertices << std::setw(12)
+              << sample.edges << "  " << std::left << std::setw(16) << sample.phase << std::right << std::fixed
+              << std::setprecision(1) << std::setw(11) << sample.wallMs << std::setw(10) << sample.peakMb;
+    if (sample.colors > 0)
+        std::cout << std::setw(7) << sample.colors << std::setw(10) << sample.conflicts;
+    std::cout << "\n";
+}
+
+// Gera, lê e colore uma instância; cada fase vira uma amostra.
+std::vector<PhaseSample> runScenario(const ScalingOptions &options, GeneratorModel model, int vertices)
+{
+    GeneratorSpec spec;
+    spec.model = model;
+    spec.vertices = vertices;
+    spec.averageDegree = options.averageDegree;
+    spec.colors = options.colors;
+    spec.seed = options.seed;
+
+    std::vector<PhaseSample> samples;
+    PhaseSample base;
+    base.model = GeneratorSpec::modelName(model);
+
+    auto phase = [&](const std::string &name, auto body)
+    {
+        PhaseSample sample = base;
+        sample.phase = name;
+        resetPeakMemory();
+        sample.wallMs = measureMs([&]
+                                  { body(sample); });
+        sample.peakMb = peakMemoryMb();
+        printSample(sample);
+        samples.push_back(sample);
+    };
+
+    const std::string path = (std::filesystem::path(options.directory) / (base.model + "_" + std::to_string(vertices) + ".col")).string();
+    {
+        GraphGenerator generator(spec);
+        base.vertices = generator.getNumVertices();
+        std::vector<int> degrees;
+        GraphGenerator::FileInfo info;
+        phase("geração", [&](PhaseSample &sample)
+              {
+                  sample.edges = base.edges = generator.countEdges(&degrees);
+                  info = generator.writeDimacs(path, base.edges); });
+        phase("cache binário", [&](PhaseSample &)
+              { generator.writeCache(path, info, degrees); });
+    }
+
+    Graph graph(0, {});
+    phase("leitura DIMACS", [&](PhaseSample &)
+          { InstanceReader reader(path, false, false); });
+    phase("leitura cache", [&](PhaseSample &)
+          {
+              InstanceReader reader(path);
+              if (!reader.isFromCache())
+                  throw std::runtime_error(path + ": o cache binário não foi usado");
+              graph = reader.takeGraph(); });
+
+    SearchBudget budget;
+    budget.setTimeLimit(options.timeLimit);
+
+    phase("SA-N" + std::to_string(options.neighborhood), [&](PhaseSample &sample)
+          {
+              std::ostringstream discard;
+              AnnealingParameters parameters = AnnealingParameters::adaptiveDefaults(0); // sem limite de iterações: vale o tempo
+              GraphColoring_SimulatedAnnealing annealing(graph, parameters.initialTemp, parameters.coolingRate, parameters.maxIterations, discard);
+              annealing.setParameters(parameters);
+              annealing.setBudget(budget);
+              annealing.setSeed(options.seed);
+              annealing.simulatedAnnealing(options.neighborhood);
+              sample.colors = annealing.getVerification().colorSpan();
+              sample.conflicts = static_cast<int>(annealing.getVerification().conflicts); });
+
+    phase("TabuCol", [&](PhaseSample &sample)
+          {
+              std::ostringstream discard;
+              GraphColoring_TabuCol tabuCol(graph, options.timeLimit, 0, discard);
+              tabuCol.setSeed(options.seed);
+              tabuCol.tabuCol();
+              sample.colors = tabuCol.getVerification().colorSpan();
+              sample.conflicts = static_cast<int>(tabuCol.getVerification().conflicts); });
+
+    phase("LS", [&](PhaseSample &sample)
+          {
+              std::ostringstream discard;
+              GraphColoring_LocalSearch localSearch(graph, discard);
+              localSearch.setBudget(budget);
+              localSearch.localSearch();
+              for (const auto &result : localSearch.getResults())
+              {
+                  int colors = result.verification.colorSpan();
+                  int conflicts = static_cast<int>(result.verification.conflicts);
+                  if (sample.colors == 0 || conflicts < sample.conflicts || (conflicts == sample.conflicts && colors < sample.colors))
+                  {
+                      sample.colors = colors;
+                      sample.conflicts = conflicts;
+                  }
+              } });
+
+    if (!options.keep)
+    {
+        std::filesystem::remove(path);
+        std::filesystem::remove(GraphCache::cachePathFor(path));
+    }
+    return samples;
+}
+
+void saveSamples(const std::string &path, const std::vector<PhaseSample> &samples)
+{
+    std::ofstream out(path, std::ios::trunc);
+    if (!out.is_open())
+        throw std::runtime_error(path + ": não foi possível gravar as medições");
+    out << "model,vertices,edges,phase,wall_ms,peak_mb,colors,conflicts\n";
+    for (const PhaseSample &s : samples)
+        out << s.model << ',' << s.vertices << ',' << s.edges << ',' << s.phase << ',' << s.wallMs << ',' << s.peakMb << ','
+            << s.colors << ',' << s.conflicts << "\n";
+}
+
+int main(int argc, char **argv)
+{
+    ScalingOptions options;
+    try
+    {
+        options = parseOptions(argc, argv);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Erro: " << e.what() << "\n";
+        return 1;
+    }
+
+    std::cout << std::left << std::setw(11) << "modelo" << std::right << std::setw(10) << "vértices" << std::setw(12)
+              << "arestas" << "  " << std::left << std::setw(16) << "fase" << std::right << std::setw(11) << "ms"
+              << std::setw(10) << "pico MB" << std::setw(7) << "cores" << std::setw(10) << "colisões" << "\n";
+
+    std::vector<PhaseSample> samples;
+    int failures = 0;
+    for (GeneratorModel model : options.models)
+    {
+        for (int vertices : options.sizes)
+        {
+            try
+            {
+                std::vector<PhaseSample> scenario = runScenario(options, model, vertices);
+                samples.insert(samples.end(), scenario.begin(), scenario.end());
+            }
+            catch (const std::exception &e)
+            {
+                std::cerr << "Erro em " << GeneratorSpec::modelName(model) << " com " << vertices << " vértices: " << e.what() << "\n";
+                ++failures;
+            }
+        }
+    }
+
+    if (!options.savePath.empty())
+    {
+        try
+        {
+            saveSamples(options.savePath, samples);
+            std::cout << "Medições salvas em " << options.savePath << "\n";
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Erro: " << e.what() << "\n";
+            return 1;
+        }
+    }
+    return failures == 0 ? 0 : 1;
+}
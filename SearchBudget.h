@@ -0,0 +1,217 @@
+#ifndef SEARCH_BUDGET_H
+#define SEARCH_BUDGET_H
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <algorithm>
+
+// Critérios de parada comuns aos solvers (modo anytime). Todos são opcionais:
+//  - tempo limite de parede, em segundos;
+//  - número-alvo de cores: para assim que houver coloração legal com até tantas cores;
+//  - parar na primeira solução sem conflitos;
+//  - limite inferior conhecido (ex.: clique, ver CliqueBound): uma coloração legal
+//    com essa quantidade de cores é ótima e a busca para;
+//  - pedido externo de parada (requestStop), que vale para todas as cópias do orçamento.
+// Ao parar, o solver devolve a melhor solução encontrada até ali.
+class SearchBudget
+{
+public:
+    enum class StopReason
+    {
+        None,
+        TimeLimit,
+        Target,
+        Optimal,
+        Cancelled
+    };
+
+    SearchBudget() : stopFlag(std::make_shared<std::atomic<bool>>(false)) {}
+
+    using Clock = std::chrono::steady_clock;
+
+    SearchBudget &setTimeLimit(double seconds)
+    {
+        timeLimitSeconds = seconds;
+        clockStarted = false;
+        return *this;
+    }
+
+    // Fixa agora o fim do tempo limite: as cópias feitas depois (as cadeias de um
+    // multi-start, por exemplo) param todas no mesmo instante, por mais que esperem
+    // na fila do pool. Sem tempo limite não faz nada; sem esta chamada, cada Deadline
+    // conta o tempo limite a partir da própria criação.
+    SearchBudget &startClock()
+    {
+        if (hasTimeLimit() && !clockStarted)
+        {
+            endTime = Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(timeLimitSeconds));
+            clockStarted = true;
+        }
+        return *this;
+    }
+
+    bool hasFixedEnd() const { return clockStarted; }
+    Clock::time_point getFixedEnd() const { return endTime; }
+
+    SearchBudget &setTargetColors(int colors)
+    {
+        targetColors = colors;
+        return *this;
+    }
+
+    SearchBudget &setStopOnZeroConflicts(bool stop)
+    {
+        stopOnZeroConflicts = stop;
+        return *this;
+    }
+
+    SearchBudget &setLowerBound(int colors)
+    {
+        lowerBound = colors;
+        return *this;
+    }
+
+    double getTimeLimit() const { return timeLimitSeconds; }
+    int getTargetColors() const { return targetColors; }
+    bool getStopOnZeroConflicts() const { return stopOnZeroConflicts; }
+    int getLowerBound() const { return lowerBound; }
+
+    bool hasTimeLimit() const { return timeLimitSeconds > 0; }
+
+    // Pode ser chamado de outra thread; o solver percebe na próxima checagem do relógio.
+    void requestStop() const { stopFlag->store(true, std::memory_order_relaxed); }
+    bool stopRequested() const { return stopFlag->load(std::memory_order_relaxed); }
+
+    bool targetReached(int colors, int conflicts) const
+    {
+        if (conflicts != 0)
+            return false;
+        return stopOnZeroConflicts || (targetColors > 0 && colors <= targetColors) || isOptimal(colors, conflicts);
+    }
+
+    bool isOptimal(int colors, int conflicts) const
+    {
+        return conflicts == 0 && lowerBound > 0 && colors <= lowerBound;
+    }
+
+    // Diferença entre as cores usadas e o limite inferior; -1 sem limite conhecido.
+    int gap(int colors) const
+    {
+        return lowerBound > 0 ? colors - lowerBound : -1;
+    }
+
+    static const char *describe(StopReason reason)
+    {
+        switch (reason)
+        {
+        case StopReason::TimeLimit:
+            return "tempo esgotado";
+        case StopReason::Target:
+            return "alvo atingido";
+        case StopReason::Optimal:
+            return "ótimo (limite inferior atingido)";
+        case StopReason::Cancelled:
+            return "interrompida";
+        default:
+            return "concluída";
+        }
+    }
+
+private:
+    double timeLimitSeconds = 0;
+    bool clockStarted = false;
+    Clock::time_point endTime; // com clockStarted: fim absoluto do tempo limite
+    int targetColors = 0;
+    bool stopOnZeroConflicts = false;
+    int lowerBound = 0;
+    std::shared_ptr<std::atomic<bool>> stopFlag;
+};
+
+// Relógio de uma execução. expired() é chamado a cada iteração, mas só lê o
+// relógio a cada `stride` chamadas; o stride se ajusta para que as leituras
+// aconteçam a cada ~CHECK_PERIOD, qualquer que seja o custo da iteração.
+class Deadline
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr double CHECK_PERIOD_SECONDS = 0.001;
+    static constexpr long long MAX_STRIDE = 1 << 20;
+
+    explicit Deadline(const SearchBudget &budget, const std::atomic<bool> *peerStop = nullptr)
+        : budget(budget), peerStop(peerStop), start(Clock::now()), lastCheck(start)
+    {
+        if (budget.hasFixedEnd())
+            limit = budget.getFixedEnd();
+        else if (budget.hasTimeLimit())
+            limit = start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(budget.getTimeLimit()));
+    }
+
+    bool expired()
+    {
+        if (--countdown > 0)
+            return false;
+        return check();
+    }
+
+    // Checagem imediata (fora do laço quente). O alvo de qualidade não conta aqui:
+    // quem o atinge decide se para (ver targetReached).
+    bool check()
+    {
+        if (reason == SearchBudget::StopReason::TimeLimit || reason == SearchBudget::StopReason::Cancelled)
+            return true;
+        if (budget.stopRequested() || (peerStop != nullptr && peerStop->load(std::memory_order_relaxed)))
+        {
+            reason = SearchBudget::StopReason::Cancelled;
+            return true;
+        }
+
+        Clock::time_point now = Clock::now();
+        if (budget.hasTimeLimit() && now >= limit)
+        {
+            reason = SearchBudget::StopReason::TimeLimit;
+            return true;
+        }
+
+        double sinceLast = std::chrono::duration<double>(now - lastCheck).count();
+        if (sinceLast < CHECK_PERIOD_SECONDS / 2)
+            stride = std::min(stride * 2, MAX_STRIDE);
+        else if (sinceLast > CHECK_PERIOD_SECONDS * 2 && stride > 1)
+            stride /= 2;
+        lastCheck = now;
+        countdown = stride;
+        return false;
+    }
+
+    // Registra o alvo de qualidade; devolve true se a busca deve parar.
+    bool targetReached(int colors, int conflicts)
+    {
+        if (budget.targetReached(colors, conflicts))
+        {
+            reason = budget.isOptimal(colors, conflicts) ? SearchBudget::StopReason::Optimal : SearchBudget::StopReason::Target;
+            return true;
+        }
+        return false;
+    }
+
+    bool stopped() const { return reason != SearchBudget::StopReason::None; }
+    SearchBudget::StopReason stopReason() const { return reason; }
+
+    double elapsedSeconds() const
+    {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+private:
+    const SearchBudget &budget;
+    const std::atomic<bool> *peerStop;
+    Clock::time_point start;
+    Clock::time_point lastCheck;
+    Clock::time_point limit;
+    long long stride = 1;
+    long long countdown = 1;
+    SearchBudget::StopReason reason = SearchBudget::StopReason::None;
+};
+
+#endif // SEARCH_BUDGET_H
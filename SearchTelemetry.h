@@ -0,0 +1,250 @@
+#ifndef SEARCH_TELEMETRY_H
+#define SEARCH_TELEMETRY_H
+
+#include <iostream>
+#include <string>
+#include <mutex>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include "TextFormat.h"
+
+// Telemetria de busca. Compile com -DGCOL_TELEMETRY=0 para removê-la: todos os
+// métodos de SearchTelemetry viram retornos imediatos e o otimizador os descarta.
+#ifndef GCOL_TELEMETRY
+#define GCOL_TELEMETRY 1
+#endif
+
+// Uma linha exportada: "sample" a cada intervalo de iterações (contadores
+// acumulados de todas as vizinhanças) e "final", uma por vizinhança usada.
+struct TelemetryRecord
+{
+    const char *event = "sample";
+    std::string run;
+    int neighborhood = 0; // 0 = todas
+    long long iteration = 0;
+    double elapsedMs = 0;
+    double temperature = 0;
+    int currentCost = 0;
+    int currentCollisions = 0;
+    int bestCost = 0;
+    int bestCollisions = 0;
+    long long proposed = 0;
+    long long accepted = 0;
+    long long rejected = 0;
+    double generationMs = 0;
+    double evaluationMs = 0;
+};
+
+// Destino das linhas em CSV (cabeçalho na primeira escrita) ou JSONL. Pode ser
+// compartilhado entre cadeias em threads diferentes: cada escrita é atômica.
+class TelemetrySink
+{
+public:
+    using Format = TextFormat::Format;
+
+    TelemetrySink(std::ostream &out, Format format) : out(out), format(format) {}
+
+    void write(const TelemetryRecord &r)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (format == Format::Csv)
+        {
+            if (!headerWritten)
+            {
+                out << "event,run,neighborhood,iteration,elapsed_ms,temperature,current_cost,current_collisions,"
+                       "best_cost,best_collisions,proposed,accepted,rejected,generation_ms,evaluation_ms\n";
+                headerWritten = true;
+            }
+            out << r.event << ',' << TextFormat::quoteCsv(r.run) << ',' << r.neighborhood << ',' << r.iteration << ','
+                << r.elapsedMs << ',' << r.temperature << ',' << r.currentCost << ',' << r.currentCollisions << ','
+                << r.bestCost << ',' << r.bestCollisions << ',' << r.proposed << ',' << r.accepted << ','
+                << r.rejected << ',' << r.generationMs << ',' << r.evaluationMs << '\n';
+        }
+        else
+        {
+            out << "{\"event\":\"" << r.event << "\",\"run\":\"" << TextFormat::escapeJson(r.run) << "\",\"neighborhood\":"
+                << r.neighborhood << ",\"iteration\":" << r.iteration << ",\"elapsedMs\":" << r.elapsedMs
+                << ",\"temperature\":" << r.temperature << ",\"currentCost\":" << r.currentCost
+                << ",\"currentCollisions\":" << r.currentCollisions << ",\"bestCost\":" << r.bestCost
+                << ",\"bestCollisions\":" << r.bestCollisions << ",\"proposed\":" << r.proposed
+                << ",\"accepted\":" << r.accepted << ",\"rejected\":" << r.rejected
+                << ",\"generationMs\":" << r.generationMs << ",\"evaluationMs\":" << r.evaluationMs << "}\n";
+        }
+    }
+
+    void flush()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        out.flush();
+    }
+
+private:
+    std::ostream &out;
+    Format format;
+    bool headerWritten = false;
+    std::mutex mutex;
+};
+
+// Contadores de uma execução: movimentos propostos/aceitos/rejeitados por
+// vizinhança e tempo gasto gerando versus avaliando movimentos. Para não pagar
+// duas leituras de relógio por iteração, só uma a cada TIMING_STRIDE é cronometrada
+// e os tempos exportados são a estimativa (soma amostrada x TIMING_STRIDE).
+class SearchTelemetry
+{
+public:
+    static constexpr bool enabled = GCOL_TELEMETRY != 0;
+    static constexpr int MAX_NEIGHBORHOODS = 5; // ids 1..4 de AnnealingNeighborhoods; 0 não é usado
+    static constexpr long long TIMING_STRIDE = 64;
+
+    using Clock = std::chrono::steady_clock;
+
+    // Sem destino (ou intervalo <= 0) os contadores continuam valendo, mas nada é exportado.
+    void attach(TelemetrySink *telemetrySink, const std::string &runLabel, long long interval)
+    {
+        sink = telemetrySink;
+        run = runLabel;
+        sampleInterval = interval;
+    }
+
+    TelemetrySink *getSink() const { return sink; }
+    const std::string &getRun() const { return run; }
+    long long getSampleInterval() const { return sampleInterval; }
+
+    void start()
+    {
+        if (!enabled)
+            return;
+        for (int k = 0; k < MAX_NEIGHBORHOODS; ++k)
+            counters[k] = Counters();
+        startTime = Clock::now();
+        timed = false;
+        nextSample = sink != nullptr && sampleInterval > 0 ? sampleInterval : std::numeric_limits<long long>::max();
+    }
+
+    void beginIteration(long long iteration)
+    {
+        if (!enabled)
+            return;
+        timed = iteration % TIMING_STRIDE == 0;
+        if (timed)
+            phaseStart = Clock::now();
+    }
+
+    // Fim da geração do movimento de `neighborhood`, início da avaliação.
+    void beginEvaluation(int neighborhood)
+    {
+        if (!enabled)
+            return;
+        current = slot(neighborhood);
+        ++counters[current].proposed;
+        if (timed)
+        {
+            Clock::time_point now = Clock::now();
+            counters[current].generationNs += std::chrono::duration_cast<std::chrono::nanoseconds>(now - phaseStart).count();
+            phaseStart = now;
+        }
+    }
+
+    void endIteration(bool accepted)
+    {
+        if (!enabled)
+            return;
+        if (accepted)
+            ++counters[current].accepted;
+        else
+            ++counters[current].rejected;
+        if (timed)
+            counters[current].evaluationNs += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - phaseStart).count();
+    }
+
+    void sample(long long iteration, double temperature, int currentCost, int currentCollisions, int bestCost, int bestCollisions)
+    {
+        if (!enabled || iteration < nextSample)
+            return;
+        nextSample = iteration + sampleInterval;
+        TelemetryRecord record = makeRecord("sample", 0, iteration, temperature, currentCost, currentCollisions, bestCost, bestCollisions);
+        for (int k = 0; k < MAX_NEIGHBORHOODS; ++k)
+            addCounters(record, counters[k]);
+        sink->write(record);
+    }
+
+    void finish(long long iterations, double temperature, int currentCost, int currentCollisions, int bestCost, int bestCollisions)
+    {
+        finalTemperature = temperature;
+        if (!enabled || sink == nullptr)
+            return;
+        for (int k = 0; k < MAX_NEIGHBORHOODS; ++k)
+        {
+            if (counters[k].proposed == 0)
+                continue;
+            TelemetryRecord record = makeRecord("final", k, iterations, temperature, currentCost, currentCollisions, bestCost, bestCollisions);
+            addCounters(record, counters[k]);
+            sink->write(record);
+        }
+    }
+
+    long long proposed(int neighborhood) const { return counters[slot(neighborhood)].proposed; }
+    long long accepted(int neighborhood) const { return counters[slot(neighborhood)].accepted; }
+    long long rejected(int neighborhood) const { return counters[slot(neighborhood)].rejected; }
+    double getFinalTemperature() const { return finalTemperature; }
+
+private:
+    struct Counters
+    {
+        long long proposed = 0;
+        long long accepted = 0;
+        long long rejected = 0;
+        int64_t generationNs = 0;
+        int64_t evaluationNs = 0;
+    };
+
+    TelemetrySink *sink = nullptr;
+    std::string run;
+    long long sampleInterval = 0;
+    long long nextSample = std::numeric_limits<long long>::max(); // evita uma divisão por iteração
+    Counters counters[MAX_NEIGHBORHOODS];
+    int current = 0;
+    bool timed = false;
+    Clock::time_point startTime;
+    Clock::time_point phaseStart;
+    double finalTemperature = 0;
+
+    // Vizinhança desconhecida é erro: somar os contadores dela em outra posição
+    // misturaria as estatísticas das duas.
+    static int slot(int neighborhood)
+    {
+        if (neighborhood < 0 || neighborhood >= MAX_NEIGHBORHOODS)
+            throw std::out_of_range("telemetria: vizinhança " + std::to_string(neighborhood) + " fora de 0.." + std::to_string(MAX_NEIGHBORHOODS - 1));
+        return neighborhood;
+    }
+
+    TelemetryRecord makeRecord(const char *event, int neighborhood, long long iteration, double temperature, int currentCost,
+                               int currentCollisions, int bestCost, int bestCollisions) const
+    {
+        TelemetryRecord record;
+        record.event = event;
+        record.run = run;
+        record.neighborhood = neighborhood;
+        record.iteration = iteration;
+        record.elapsedMs = std::chrono::duration<double, std::milli>(Clock::now() - startTime).count();
+        record.temperature = temperature;
+        record.currentCost = currentCost;
+        record.currentCollisions = currentCollisions;
+        record.bestCost = bestCost;
+        record.bestCollisions = bestCollisions;
+        return record;
+    }
+
+    static void addCounters(TelemetryRecord &record, const Counters &c)
+    {
+        record.proposed += c.proposed;
+        record.accepted += c.accepted;
+        record.rejected += c.rejected;
+        record.generationMs += std::chrono::duration<double, std::milli>(std::chrono::nanoseconds(c.generationNs)).count() * TIMING_STRIDE;
+        record.evaluationMs += std::chrono::duration<double, std::milli>(std::chrono::nanoseconds(c.evaluationNs)).count() * TIMING_STRIDE;
+    }
+};
+
+#endif // SEARCH_TELEMETRY_H
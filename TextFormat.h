@@ -0,0 +1,85 @@
+#ifndef TEXT_FORMAT_H
+#define TEXT_FORMAT_H
+
+#include <cstdio>
+#include <string>
+
+// Formatação comum às saídas em texto (registros de resultados, telemetria, baseline
+// do Benchmark): formato pela extensão, campos CSV e strings JSON.
+namespace TextFormat
+{
+    enum class Format
+    {
+        Csv,
+        Jsonl
+    };
+
+    // .csv -> Csv; qualquer outra extensão -> Jsonl.
+    inline Format formatFor(const std::string &path)
+    {
+        return path.size() >= 4 && path.compare(path.size() - 4, 4, ".csv") == 0 ? Format::Csv : Format::Jsonl;
+    }
+
+    // Campo CSV: entre aspas (com aspas dobradas) só se tiver vírgula, aspas ou quebra de linha.
+    inline std::string quoteCsv(const std::string &text)
+    {
+        if (text.find_first_of(",\"\n") == std::string::npos)
+            return text;
+        std::string quoted = "\"";
+        for (char c : text)
+        {
+            if (c == '"')
+                quoted += '"';
+            quoted += c;
+        }
+        return quoted + "\"";
+    }
+
+    // Conteúdo de uma string JSON (sem as aspas externas): aspas, barra invertida e
+    // caracteres de controle escapados (\n, \t... ou \u00XX), que o JSON proíbe crus.
+    inline std::string escapeJson(const std::string &text)
+    {
+        std::string escaped;
+        for (char c : text)
+        {
+            switch (c)
+            {
+            case '"':
+                escaped += "\\\"";
+                break;
+            case '\\':
+                escaped += "\\\\";
+                break;
+            case '\b':
+                escaped += "\\b";
+                break;
+            case '\f':
+                escaped += "\\f";
+                break;
+            case '\n':
+                escaped += "\\n";
+                break;
+            case '\r':
+                escaped += "\\r";
+                break;
+            case '\t':
+                escaped += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    char code[7];
+                    std::snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned char>(c));
+                    escaped += code;
+                }
+                else
+                {
+                    escaped += c;
+                }
+            }
+        }
+        return escaped;
+    }
+}
+
+#endif // TEXT_FORMAT_H
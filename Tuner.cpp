@@ -0,0 +1,359 @@
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <stdexcept>
+#include "InstanceReader.h"
+#include "Graph.h"
+#include "GraphColoring_SimulatedAnnealing.h"
+#include "AnnealingSchedule.h"
+#include "WorkStealingPool.h"
+#include "Random.h"
+
+// Ajuste de parâmetros da têmpera simulada por corrida (racing, no estilo F-Race).
+// Para cada família de instâncias (sufixo do nome: LEI, REG, SGB, MYC, ...) e cada
+// vizinhança, um conjunto de candidatos (resfriamento fixo e adaptativo) disputa
+// rodadas; cada rodada é uma instância da família com uma semente nova. Os
+// candidatos são ordenados em cada rodada (menos colisões, depois menos cores,
+// depois menos tempo) e, a partir de --min-rounds, sai quem tiver soma de postos
+// pior que a do líder por mais que Z * sqrt(r * k * (k + 1) / 6), o desvio da
+// diferença de somas de postos sob a hipótese de candidatos equivalentes. As
+// rodadas de todas as corridas ainda abertas rodam juntas no pool. O vencedor de
+// cada corrida é gravado no formato lido por AnnealingTuning::load (main --tuning).
+//
+// Uso: Tuner [opções] [instância ...]
+//   --instances <dir>        diretório das instâncias (padrão ../Instances)
+//   --neighborhoods <lista>  vizinhanças separadas por vírgula (padrão: todas, 1,2,3,4)
+//   --iterations <n>         iterações por execução (padrão 10000)
+//   --rounds <n>             rodadas por corrida (padrão 10)
+//   --min-rounds <n>         rodadas antes da primeira eliminação (padrão 3)
+//   --seed <s>               semente mestre (padrão 20250119)
+//   --filter <texto>         só instâncias cujo nome contém o texto
+//   --save <arquivo>         onde gravar os vencedores (padrão annealing_tuning.txt)
+
+struct TunerOptions
+{
+    std::string instancesDir = "../Instances";
+    std::vector<std::string> instances;
+    std::vector<int> neighborhoods = policyIds(AnnealingNeighborhoods{});
+    int iterations = 10000;
+    int rounds = 10;
+    int minRounds = 3;
+    uint64_t seed = 20250119;
+    std::string filter;
+    std::string savePath = "annealing_tuning.txt";
+};
+
+// Quantil normal usado no corte de eliminação (~95% unilateral).
+const double ELIMINATION_Z = 1.645;
+
+struct Evaluation
+{
+    int conflicts = 0;
+    int colors = 0;
+    double wallMs = 0;
+
+    bool operator<(const Evaluation &other) const
+    {
+        if (conflicts != other.conflicts)
+            return conflicts < other.conflicts;
+        return colors < other.colors;
+    }
+};
+
+// Uma corrida: uma família, uma vizinhança e os candidatos ainda vivos.
+struct Race
+{
+    std::string family;
+    int neighborhood = 0;
+    std::vector<const Graph *> instances;
+    std::vector<char> alive;
+    std::vector<std::vector<Evaluation>> results; // results[rodada][candidato]
+};
+
+std::vector<AnnealingParameters> makeCandidates(int iterations)
+{
+    std::vector<AnnealingParameters> candidates;
+    for (double initialTemp : {1000.0, 10.0, 1.0})
+    {
+        for (double coolingRate : {0.99, 0.999})
+        {
+            AnnealingParameters parameters;
+            parameters.initialTemp = initialTemp;
+            parameters.coolingRate = coolingRate;
+            parameters.maxIterations = iterations;
+            candidates.push_back(parameters);
+        }
+    }
+    for (double initialAcceptance : {0.5, 0.8, 0.95})
+    {
+        for (double plateauFraction : {0.02, 0.1})
+        {
+            AnnealingParameters parameters = AnnealingParameters::adaptiveDefaults(iterations);
+            parameters.initialAcceptance = initialAcceptance;
+            parameters.plateauFraction = plateauFraction;
+            candidates.push_back(parameters);
+        }
+    }
+    return candidates;
+}
+
+Evaluation evaluate(const Graph &graph, const AnnealingParameters &parameters, int neighborhood, uint64_t seed)
+{
+    std::ostringstream discard;
+    GraphColoring_SimulatedAnnealing annealing(graph, parameters.initialTemp, parameters.coolingRate, parameters.maxIterations, discard);
+    annealing.setParameters(parameters);
+    annealing.setSeed(seed);
+
+    auto start = std::chrono::steady_clock::now();
+    annealing.simulatedAnnealing(neighborhood);
+
+    Evaluation evaluation;
+    evaluation.wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    evaluation.colors = annealing.getVerification().colorSpan();
+    evaluation.conflicts = static_cast<int>(annealing.getVerification().conflicts);
+    return evaluation;
+}
+
+// Soma dos postos de cada candidato vivo, recalculada só entre os vivos (empates
+// recebem o posto médio; o tempo desempata quando a qualidade é igual).
+std::vector<double> rankSums(const Race &race)
+{
+    std::vector<double> sums(race.alive.size(), 0);
+    std::vector<int> members;
+    for (size_t c = 0; c < race.alive.size(); ++c)
+    {
+        if (race.alive[c])
+            members.push_back(static_cast<int>(c));
+    }
+
+    for (const auto &round : race.results)
+    {
+        auto better = [&](int a, int b)
+        {
+            if (round[a] < round[b] || round[b] < round[a])
+                return round[a] < round[b];
+            return round[a].wallMs < round[b].wallMs;
+        };
+        std::vector<int> order = members;
+        std::sort(order.begin(), order.end(), better);
+        for (size_t i = 0; i < order.size();)
+        {
+            size_t j = i;
+            while (j + 1 < order.size() && !better(order[i], order[j + 1]) && !better(order[j + 1], order[i]))
+                ++j;
+            double rank = (i + j) / 2.0 + 1;
+            for (size_t t = i; t <= j; ++t)
+                sums[order[t]] += rank;
+            i = j + 1;
+        }
+    }
+    return sums;
+}
+
+int leaderOf(const Race &race, const std::vector<double> &sums)
+{
+    int leader = -1;
+    for (size_t c = 0; c < race.alive.size(); ++c)
+    {
+        if (race.alive[c] && (leader == -1 || sums[c] < sums[leader]))
+            leader = static_cast<int>(c);
+    }
+    return leader;
+}
+
+// Elimina os candidatos estatisticamente piores que o líder; devolve quantos restam.
+int eliminate(Race &race)
+{
+    std::vector<double> sums = rankSums(race);
+    int leader = leaderOf(race, sums);
+    int k = static_cast<int>(std::count(race.alive.begin(), race.alive.end(), 1));
+    double rounds = static_cast<double>(race.results.size());
+    double margin = ELIMINATION_Z * std::sqrt(rounds * k * (k + 1) / 6.0);
+
+    int survivors = 0;
+    for (size_t c = 0; c < race.alive.size(); ++c)
+    {
+        if (race.alive[c] && sums[c] - sums[leader] > margin)
+            race.alive[c] = 0;
+        survivors += race.alive[c];
+    }
+    return survivors;
+}
+
+TunerOptions parseOptions(int argc, char **argv)
+{
+    TunerOptions options;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        auto value = [&]() -> std::string
+        {
+            if (i + 1 >= argc)
+                throw std::runtime_error("faltou o valor de " + arg);
+            return argv[++i];
+        };
+
+        if (arg == "--instances")
+            options.instancesDir = value();
+        else if (arg == "--neighborhoods")
+        {
+            options.neighborhoods.clear();
+            std::istringstream list(value());
+            std::string item;
+            while (std::getline(list, item, ','))
+                options.neighborhoods.push_back(std::stoi(item));
+        }
+        else if (arg == "--iterations")
+            options.iterations = std::stoi(value());
+        else if (arg == "--rounds")
+            options.rounds = std::max(1, std::stoi(value()));
+        else if (arg == "--min-rounds")
+            options.minRounds = std::max(1, std::stoi(value()));
+        else if (arg == "--seed")
+            options.seed = std::stoull(value());
+        else if (arg == "--filter")
+            options.filter = value();
+        else if (arg == "--save")
+            options.savePath = value();
+        else if (!arg.empty() && arg[0] == '-')
+            throw std::runtime_error("opção desconhecida: " + arg);
+        else
+            options.instances.push_back(arg);
+    }
+
+    if (options.instances.empty())
+    {
+        for (const auto &entry : std::filesystem::directory_iterator(options.instancesDir))
+        {
+            std::string extension = entry.path().extension().string();
+            if (entry.is_regular_file() && (extension == ".txt" || extension == ".col"))
+                options.instances.push_back(entry.path().string());
+        }
+        std::sort(options.instances.begin(), options.instances.end());
+    }
+    return options;
+}
+
+int main(int argc, char **argv)
+{
+    TunerOptions options;
+    try
+    {
+        options = parseOptions(argc, argv);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Erro: " << e.what() << "\n";
+        return 1;
+    }
+
+    // Instâncias agrupadas por família
+    std::vector<std::unique_ptr<Graph>> graphs;
+    std::map<std::string, std::vector<const Graph *>> families;
+    for (const std::string &path : options.instances)
+    {
+        std::string name = std::filesystem::path(path).filename().string();
+        if (!options.filter.empty() && name.find(options.filter) == std::string::npos)
+            continue;
+        try
+        {
+            InstanceReader reader(path);
+            graphs.emplace_back(new Graph(reader.takeGraph()));
+            families[AnnealingTuning::familyOf(name)].push_back(graphs.back().get());
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Erro ao ler " << path << ": " << e.what() << "\n";
+        }
+    }
+
+    const std::vector<AnnealingParameters> candidates = makeCandidates(options.iterations);
+    std::vector<Race> races;
+    for (const auto &family : families)
+    {
+        for (int neighborhood : options.neighborhoods)
+        {
+            Race race;
+            race.family = family.first;
+            race.neighborhood = neighborhood;
+            race.instances = family.second;
+            race.alive.assign(candidates.size(), 1);
+            races.push_back(std::move(race));
+        }
+    }
+
+    WorkStealingPool pool;
+    std::cout << races.size() << " corridas, " << candidates.size() << " candidatos, " << pool.size() << " threads\n";
+
+    std::vector<char> open(races.size(), 1);
+    for (int round = 0; round < options.rounds; ++round)
+    {
+        WorkStealingPool::TaskGroup group;
+        uint64_t seed = Xoshiro256::deriveSeed(options.seed, static_cast<uint64_t>(round));
+        for (size_t r = 0; r < races.size(); ++r)
+        {
+            if (!open[r])
+                continue;
+            Race &race = races[r];
+            const Graph *graph = race.instances[round % race.instances.size()];
+            race.results.emplace_back(candidates.size());
+            std::vector<Evaluation> &slots = race.results.back();
+            for (size_t c = 0; c < candidates.size(); ++c)
+            {
+                if (!race.alive[c])
+                    continue;
+                const AnnealingParameters *parameters = &candidates[c];
+                Evaluation *slot = &slots[c];
+                int neighborhood = race.neighborhood;
+                pool.submit([graph, parameters, neighborhood, seed, slot]
+                            { *slot = evaluate(*graph, *parameters, neighborhood, seed); },
+                            group);
+            }
+        }
+        pool.wait(group);
+
+        for (size_t r = 0; r < races.size(); ++r)
+        {
+            if (open[r] && round + 1 >= options.minRounds && eliminate(races[r]) == 1)
+                open[r] = 0;
+        }
+    }
+
+    AnnealingTuning::Table winners;
+    for (const Race &race : races)
+    {
+        std::vector<double> sums = rankSums(race);
+        int leader = leaderOf(race, sums);
+        int survivors = static_cast<int>(std::count(race.alive.begin(), race.alive.end(), 1));
+        double meanColors = 0;
+        for (const auto &round : race.results)
+            meanColors += round[leader].colors;
+        meanColors /= race.results.size();
+
+        winners[{race.family, race.neighborhood}] = candidates[leader];
+        std::cout << std::left << std::setw(6) << race.family << " N" << race.neighborhood << std::right
+                  << "  rodadas " << std::setw(3) << race.results.size() << "  vivos " << std::setw(2) << survivors
+                  << "  cores médias " << std::fixed << std::setprecision(2) << meanColors << "  "
+                  << candidates[leader].describe() << "\n";
+    }
+
+    try
+    {
+        AnnealingTuning::save(options.savePath, winners);
+        std::cout << "Parâmetros salvos em " << options.savePath << "\n";
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Erro: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,197 @@
+#ifndef VERTEX_ORDERING_H
+#define VERTEX_ORDERING_H
+
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <stdexcept>
+#include <cstdlib>
+#include "Graph.h"
+
+enum class VertexOrder
+{
+    None,
+    Degree,             // grau decrescente: vértices de grau alto ficam juntos no início
+    ReverseCuthillMcKee // BFS por grau crescente, invertida: vizinhos ficam próximos (banda pequena)
+};
+
+// Renumeração dos vértices antes dos solvers. Nos arquivos REG e SGB os ids não
+// têm localidade, então cada leitura de vizinho (colors[u], linhas da
+// ConflictTable) cai numa linha de cache diferente; com a ordem RCM os vizinhos
+// de v ficam em ids próximos de v e as varreduras reaproveitam as mesmas linhas.
+// graph() é o grafo renumerado; mapBack() devolve uma coloração dele nos ids de
+// entrada. O grafo de entrada pode ser descartado depois da construção.
+class VertexOrdering
+{
+public:
+    VertexOrdering(const Graph &source, VertexOrder order) : n(source.getNumVertices())
+    {
+        switch (order)
+        {
+        case VertexOrder::Degree:
+            newToOld = source.getDegreeOrder();
+            break;
+        case VertexOrder::ReverseCuthillMcKee:
+            newToOld = reverseCuthillMcKee(source);
+            break;
+        default:
+            newToOld.resize(n);
+            for (int v = 0; v < n; ++v)
+                newToOld[v] = v;
+            break;
+        }
+
+        oldToNew.assign(n, -1);
+        for (int v = 0; v < n; ++v)
+            oldToNew[newToOld[v]] = v;
+
+        // CSR renumerado direto, sem passar por lista de arestas
+        std::vector<int> offsets(n + 1, 0);
+        std::vector<int> neighbors;
+        neighbors.reserve(source.getNeighbors().size());
+        for (int v = 0; v < n; ++v)
+        {
+            size_t first = neighbors.size();
+            for (int u : source.neighborsOf(newToOld[v]))
+                neighbors.push_back(oldToNew[u]);
+            std::sort(neighbors.begin() + first, neighbors.end());
+            offsets[v + 1] = static_cast<int>(neighbors.size());
+        }
+        renumbered = Graph(n, std::move(offsets), std::move(neighbors), {});
+    }
+
+    const Graph &graph() const { return renumbered; }
+    int toOriginal(int v) const { return newToOld[v]; }
+    int toLocal(int v) const { return oldToNew[v]; }
+
+    // Coloração do grafo renumerado -> coloração nos ids de entrada.
+    std::vector<int> mapBack(const std::vector<int> &colors) const
+    {
+        std::vector<int> original(n);
+        for (int v = 0; v < n; ++v)
+            original[newToOld[v]] = colors[v];
+        return original;
+    }
+
+    // Coloração nos ids de entrada -> coloração do grafo renumerado (ex.: warm start).
+    std::vector<int> mapForward(const std::vector<int> &colors) const
+    {
+        std::vector<int> local(n);
+        for (int v = 0; v < n; ++v)
+            local[v] = colors[newToOld[v]];
+        return local;
+    }
+
+    static VertexOrder parse(const std::string &name)
+    {
+        if (name == "none")
+            return VertexOrder::None;
+        if (name == "degree")
+            return VertexOrder::Degree;
+        if (name == "rcm")
+            return VertexOrder::ReverseCuthillMcKee;
+        throw std::runtime_error("ordem de vértices desconhecida: " + name);
+    }
+
+    // Distância média |u - v| entre os extremos das arestas: quanto menor, mais
+    // vizinhos compartilham linhas de cache.
+    static double meanEdgeSpan(const Graph &graph)
+    {
+        long long span = 0;
+        for (int v = 0; v < graph.getNumVertices(); ++v)
+        {
+            for (int u : graph.neighborsOf(v))
+                span += std::abs(u - v);
+        }
+        return graph.getNeighbors().empty() ? 0 : static_cast<double>(span) / graph.getNeighbors().size();
+    }
+
+private:
+    int n;
+    std::vector<int> newToOld;
+    std::vector<int> oldToNew;
+    Graph renumbered;
+
+    // Cuthill-McKee por componente, a partir de um vértice pseudo-periférico (o de
+    // menor grau no último nível de uma BFS partindo do vértice de menor grau), com
+    // os vizinhos de cada vértice visitados em grau crescente; no fim a ordem é invertida.
+    static std::vector<int> reverseCuthillMcKee(const Graph &graph)
+    {
+        const int n = graph.getNumVertices();
+        std::vector<int> order;
+        order.reserve(n);
+        std::vector<char> placed(n, 0);
+        std::vector<int> level(n, -1);
+        std::vector<int> byDegree(n);
+        for (int v = 0; v < n; ++v)
+            byDegree[v] = v;
+        std::stable_sort(byDegree.begin(), byDegree.end(), [&](int a, int b)
+                         { return graph.degree(a) < graph.degree(b); });
+
+        std::vector<int> neighbors;
+        for (int seed : byDegree)
+        {
+            if (placed[seed])
+                continue;
+
+            int start = pseudoPeripheral(graph, seed, level);
+            size_t head = order.size();
+            order.push_back(start);
+            placed[start] = 1;
+            while (head < order.size())
+            {
+                int v = order[head++];
+                neighbors.clear();
+                for (int u : graph.neighborsOf(v))
+                {
+                    if (!placed[u])
+                    {
+                        placed[u] = 1;
+                        neighbors.push_back(u);
+                    }
+                }
+                std::sort(neighbors.begin(), neighbors.end(), [&](int a, int b)
+                          { return graph.degree(a) < graph.degree(b) || (graph.degree(a) == graph.degree(b) && a < b); });
+                order.insert(order.end(), neighbors.begin(), neighbors.end());
+            }
+        }
+        std::reverse(order.begin(), order.end());
+        return order;
+    }
+
+    // Duas BFS: a segunda parte do vértice de menor grau no nível mais distante da primeira.
+    static int pseudoPeripheral(const Graph &graph, int seed, std::vector<int> &level)
+    {
+        int start = seed;
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            std::vector<int> visited(1, start);
+            level[start] = 0;
+            for (size_t head = 0; head < visited.size(); ++head)
+            {
+                int v = visited[head];
+                for (int u : graph.neighborsOf(v))
+                {
+                    if (level[u] == -1)
+                    {
+                        level[u] = level[v] + 1;
+                        visited.push_back(u);
+                    }
+                }
+            }
+
+            int farthest = level[visited.back()];
+            int candidate = visited.back();
+            for (int v : visited)
+            {
+                if (level[v] == farthest && graph.degree(v) < graph.degree(candidate))
+                    candidate = v;
+                level[v] = -1;
+            }
+            start = candidate;
+        }
+        return start;
+    }
+};
+
+#endif // VERTEX_ORDERING_H
@@ -0,0 +1,327 @@
+#ifndef WORK_STEALING_POOL_H
+#define WORK_STEALING_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Pool de threads com roubo de tarefas. Cada worker tem sua própria fila:
+// tarefas enviadas de dentro de um worker vão para a frente da fila dele e são
+// executadas primeiro (LIFO), enquanto workers ociosos roubam do fim das filas
+// dos outros. Tarefas enviadas de fora são distribuídas em round-robin, então a
+// ordem de envio define a prioridade de cada fila.
+class WorkStealingPool
+{
+public:
+    // Conjunto de tarefas que pode ser aguardado isoladamente com wait(group).
+    // pending e version só mudam sob mutex: quem espera dorme em condition até o
+    // grupo terminar ou receber tarefa nova, e o último acesso de uma tarefa ao
+    // grupo acontece antes de wait(group) poder retornar e destruí-lo.
+    class TaskGroup
+    {
+    public:
+        TaskGroup() = default;
+        TaskGroup(const TaskGroup &) = delete;
+        TaskGroup &operator=(const TaskGroup &) = delete;
+
+    private:
+        friend class WorkStealingPool;
+        std::mutex mutex;
+        std::condition_variable condition;
+        size_t pending = 0;
+        unsigned long long version = 0; // incrementada a cada tarefa enfileirada
+    };
+
+    explicit WorkStealingPool(unsigned numThreads = std::thread::hardware_concurrency())
+    {
+        if (numThreads == 0)
+            numThreads = 1;
+
+        for (unsigned i = 0; i < numThreads; ++i)
+            queues.emplace_back(new WorkerQueue());
+        for (unsigned i = 0; i < numThreads; ++i)
+            workers.emplace_back(&WorkStealingPool::workerLoop, this, i);
+    }
+
+    ~WorkStealingPool()
+    {
+        wait();
+        {
+            std::lock_guard<std::mutex> lock(idleMutex);
+            stopping = true;
+        }
+        idleCondition.notify_all();
+        for (auto &worker : workers)
+            worker.join();
+    }
+
+    WorkStealingPool(const WorkStealingPool &) = delete;
+    WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+    unsigned size() const { return static_cast<unsigned>(workers.size()); }
+
+    void submit(std::function<void()> task)
+    {
+        enqueue(Task{std::move(task), nullptr});
+    }
+
+    void submit(std::function<void()> task, TaskGroup &group)
+    {
+        // Além da tarefa, a própria submissão conta como pendente até avisar quem
+        // espera: a tarefa pode terminar antes disso, e o grupo não pode sumir antes
+        {
+            std::lock_guard<std::mutex> lock(group.mutex);
+            group.pending += 2;
+        }
+        enqueue(Task{[task = std::move(task), &group]
+                     {
+                         struct Done
+                         {
+                             TaskGroup &group;
+                             ~Done()
+                             {
+                                 std::lock_guard<std::mutex> lock(group.mutex);
+                                 if (--group.pending == 0)
+                                     group.condition.notify_all();
+                             }
+                         } done{group};
+                         task(); },
+                     &group});
+
+        std::lock_guard<std::mutex> lock(group.mutex);
+        --group.pending;
+        ++group.version;
+        group.condition.notify_all();
+    }
+
+    // Espera as tarefas do grupo executando, enquanto isso, as tarefas dele que
+    // ainda estão nas filas (e só essas), de modo que pode ser chamada de dentro de
+    // um worker sem travar o pool. Sem tarefa do grupo para pegar, dorme até o
+    // grupo terminar ou receber tarefa nova.
+    void wait(TaskGroup &group)
+    {
+        unsigned index = currentWorkerPool() == this ? currentWorkerIndex() : 0;
+        while (true)
+        {
+            unsigned long long seenVersion;
+            {
+                std::lock_guard<std::mutex> lock(group.mutex);
+                if (group.pending == 0)
+                    return;
+                seenVersion = group.version;
+            }
+
+            Task task;
+            if (takeFromGroup(index, &group, task))
+            {
+                runTask(task.run);
+                task.run = nullptr;
+                finishTask();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(group.mutex);
+            group.condition.wait(lock, [&]
+                                 { return group.pending == 0 || group.version != seenVersion; });
+            if (group.pending == 0)
+                return;
+        }
+    }
+
+    // Bloqueia até que todas as tarefas enviadas (inclusive as criadas por outras tarefas) terminem.
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(idleMutex);
+        doneCondition.wait(lock, [&]
+                           { return pending.load() == 0; });
+    }
+
+private:
+    struct Task
+    {
+        std::function<void()> run;
+        TaskGroup *group = nullptr; // grupo da tarefa, se enviada com submit(task, group)
+    };
+
+    struct WorkerQueue
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::vector<std::thread> workers;
+    std::atomic<size_t> nextQueue{0};
+    std::atomic<size_t> pending{0};
+
+    std::mutex idleMutex;
+    std::condition_variable idleCondition;
+    std::condition_variable doneCondition;
+    unsigned long long version = 0;
+    bool stopping = false;
+
+    static WorkStealingPool *&currentWorkerPool()
+    {
+        thread_local WorkStealingPool *pool = nullptr;
+        return pool;
+    }
+
+    static unsigned &currentWorkerIndex()
+    {
+        thread_local unsigned index = 0;
+        return index;
+    }
+
+    void enqueue(Task task)
+    {
+        pending.fetch_add(1);
+
+        if (currentWorkerPool() == this)
+        {
+            WorkerQueue &queue = *queues[currentWorkerIndex()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.tasks.push_front(std::move(task));
+        }
+        else
+        {
+            WorkerQueue &queue = *queues[nextQueue.fetch_add(1) % queues.size()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.tasks.push_back(std::move(task));
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(idleMutex);
+            ++version;
+        }
+        idleCondition.notify_one();
+    }
+
+    // Tira de alguma fila uma tarefa do grupo: da frente da fila de `index` primeiro
+    // (a mais recente dela), depois do fim das filas dos outros, como no roubo.
+    bool takeFromGroup(unsigned index, const TaskGroup *group, Task &task)
+    {
+        for (size_t offset = 0; offset < queues.size(); ++offset)
+        {
+            WorkerQueue &queue = *queues[(index + offset) % queues.size()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (offset == 0)
+            {
+                for (auto it = queue.tasks.begin(); it != queue.tasks.end(); ++it)
+                {
+                    if (it->group == group)
+                    {
+                        task = std::move(*it);
+                        queue.tasks.erase(it);
+                        return true;
+                    }
+                }
+            }
+            else
+            {
+                for (auto it = queue.tasks.rbegin(); it != queue.tasks.rend(); ++it)
+                {
+                    if (it->group == group)
+                    {
+                        task = std::move(*it);
+                        queue.tasks.erase(std::next(it).base());
+                        return true;
+                    }
+                }
+            }
+        }
+        return false;
+    }
+
+    bool popLocal(unsigned index, Task &task)
+    {
+        WorkerQueue &queue = *queues[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty())
+            return false;
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+        return true;
+    }
+
+    bool steal(unsigned thief, Task &task)
+    {
+        for (size_t offset = 1; offset < queues.size(); ++offset)
+        {
+            WorkerQueue &queue = *queues[(thief + offset) % queues.size()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (!queue.tasks.empty())
+            {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void finishTask()
+    {
+        if (pending.fetch_sub(1) == 1)
+        {
+            std::lock_guard<std::mutex> lock(idleMutex);
+            doneCondition.notify_all();
+        }
+    }
+
+    static void runTask(std::function<void()> &task)
+    {
+        try
+        {
+            task();
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Erro em tarefa do pool: " << e.what() << "\n";
+        }
+        catch (...)
+        {
+            std::cerr << "Erro desconhecido em tarefa do pool.\n";
+        }
+    }
+
+    void workerLoop(unsigned index)
+    {
+        currentWorkerPool() = this;
+        currentWorkerIndex() = index;
+
+        while (true)
+        {
+            unsigned long long seenVersion;
+            {
+                std::lock_guard<std::mutex> lock(idleMutex);
+                seenVersion = version;
+            }
+
+            Task task;
+            if (popLocal(index, task) || steal(index, task))
+            {
+                runTask(task.run);
+                task.run = nullptr;
+                finishTask();
+                continue;
+            }
+
+            // Dorme até que uma nova tarefa seja enviada depois da última verificação
+            std::unique_lock<std::mutex> lock(idleMutex);
+            idleCondition.wait(lock, [&]
+                               { return stopping || version != seenVersion; });
+            if (stopping)
+                return;
+        }
+    }
+};
+
+#endif // WORK_STEALING_POOL_H
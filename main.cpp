@@ -1,107 +1,505 @@
 #include <iostream>
 #include <fstream>
 #include <climits>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <filesystem>
+#include <chrono>
 #include "InstanceReader.h"
+#include "Graph.h"
 #include "GraphColoring_LocalSearch.h"        // Certifique-se de incluir o arquivo correto
 #include "GraphColoring_SimulatedAnnealing.h" // Adicionado para Têmpera Simulada
+#include "GraphColoring_TabuCol.h"
+#include "WorkStealingPool.h"
+#include "SearchTelemetry.h"
+#include "SearchBudget.h"
+#include "ResultWriter.h"
+#include "CliqueBound.h"
+#include "GraphReduction.h"
+#include "VertexOrdering.h"
+#include "AnnealingSchedule.h"
+#include "Checkpoint.h"
+#include "ColoringVerifier.h"
 
-int main()
+// Vizinhanças da têmpera simulada rodadas em cada instância (ids 1..N de AnnealingNeighborhoods)
+const int ANNEALING_NEIGHBORHOODS = 4;
+
+// Estado de uma instância durante o processamento em lote. Cada configuração de
+// solver escreve em seu próprio stream; o último job a terminar monta o arquivo.
+struct InstanceJob
 {
-    // Lista de arquivos de entrada e saída
-    std::vector<std::string> inputFiles;
-    std::vector<std::string> outputFiles;
+    size_t index = 0;
+    std::string inputFilename;
+    std::string outputFilename;
+    long long fileSize = 0;
+    std::shared_ptr<const Graph> graph;
+    std::shared_ptr<const GraphReduction> reduction; // núcleo entregue aos solvers (nulo sem redução)
+    std::shared_ptr<const VertexOrdering> ordering;  // renumeração do núcleo (ou do grafo) para localidade
+    std::shared_ptr<const ColoringVerifier> verifier; // arestas do grafo original, para verificar cada registro
+    CliqueResult clique;  // limite inferior do número cromático
+    SearchBudget budget;  // solverBudget com o limite inferior da instância
+    std::ostringstream localSearchOutput;
+    std::ostringstream annealingOutput[ANNEALING_NEIGHBORHOODS];
+    std::ostringstream tabuColOutput;
+    std::atomic<int> remaining{ANNEALING_NEIGHBORHOODS + 2}; // têmperas, TabuCol e busca local
+    std::vector<int> warmStart; // coloração de partida no grafo dos solvers (vazia sem --warm-start)
+    std::mutex bestMutex;
+    std::vector<int> bestColoring; // melhor coloração legal do grafo original entre as execuções
 
-    for (int i = 1; i <= 12; i++)
+    const Graph &reducedGraph() const { return reduction ? reduction->core() : *graph; }
+    const Graph &solverGraph() const { return ordering ? ordering->graph() : reducedGraph(); }
+
+    // Coloração do grafo dos solvers -> coloração do grafo original (desfaz renumeração e redução).
+    std::vector<int> toOriginal(const std::vector<int> &coloring) const
     {
-        inputFiles.push_back("../Instances/Instance" + std::to_string(i) + "_450_LEI.txt");
-        outputFiles.push_back("../ResultsH/output" + std::to_string(i) + "_450_LEI.txt");
+        std::vector<int> reduced = ordering ? ordering->mapBack(coloring) : coloring;
+        return reduction ? reduction->extend(reduced) : reduced;
     }
-    for (int i = 1; i <= 5; i++)
+
+    // Coloração do grafo original -> coloração do grafo dos solvers.
+    std::vector<int> toSolver(const std::vector<int> &coloring) const
     {
-        inputFiles.push_back("../Instances/Instance" + std::to_string(i) + "_MYC.txt");
-        outputFiles.push_back("../ResultsH/output" + std::to_string(i) + "_MYC.txt");
+        std::vector<int> reduced = reduction ? reduction->restrictToCore(coloring) : coloring;
+        return ordering ? ordering->mapForward(reduced) : reduced;
     }
-    for (int i = 1; i <= 14; i++)
+};
+
+std::mutex consoleMutex;
+
+// Semente mestre da bateria: cada (instância, vizinhança) deriva dela a semente
+// de suas cadeias, então a mesma semente reproduz os mesmos resultados.
+const uint64_t MASTER_SEED = 20250119;
+const int ANNEALING_CHAINS = 4;
+
+// Telemetria da têmpera simulada (--telemetry <arquivo.csv|.jsonl>), desligada por padrão
+TelemetrySink *telemetrySink = nullptr;
+long long telemetryInterval = 1000;
+
+// Registros estruturados por execução (--results <arquivo.jsonl|.csv>, --colors <arquivo>)
+ResultWriter *resultWriter = nullptr;
+
+// Parâmetros da têmpera simulada: resfriamento adaptativo por padrão, ou os vencedores
+// do Tuner para a família da instância e a vizinhança (--tuning)
+AnnealingParameters annealingDefaults = AnnealingParameters::adaptiveDefaults(10000);
+AnnealingTuning::Table annealingTuning;
+
+// Regra de aceitação da têmpera simulada (--acceptance)
+AcceptanceRule annealingAcceptance = AcceptanceRule::Metropolis;
+
+// Renumeração dos vértices antes dos solvers (--ordering none|degree|rcm). RCM por padrão:
+// é a que deixa os vizinhos mais próximos (nas instâncias LEI, REG e SGB, a distância média
+// entre os ids das pontas de uma aresta cai 17-53% em relação aos ids do arquivo; com a
+// ordem por grau, 9-32%). Qualquer renumeração muda os desempates da coloração inicial.
+VertexOrder vertexOrder = VertexOrder::ReverseCuthillMcKee;
+
+// Redução do grafo (grau < clique e vértices dominados) antes dos solvers; --no-reduction desliga
+bool reduceInstances = true;
+
+// Checkpoints da têmpera e do TabuCol (--checkpoint-dir <dir>, --checkpoint-interval <s>): uma
+// execução interrompida por tempo continua do ponto gravado na próxima com o mesmo diretório
+std::string checkpointDirectory;
+double checkpointInterval = 30.0;
+
+// Colorações de partida (--warm-start <dir>) e melhores colorações salvas (--save-colorings <dir>),
+// ambas em <dir>/<arquivo da instância>.coloring
+std::string warmStartDirectory;
+std::string savedColoringsDirectory;
+
+// Tempo limite por configuração de solver (--time-limit <s>); 0 = sem limite
+SearchBudget solverBudget;
+
+// Orçamento do TabuCol por instância (o que acabar primeiro)
+const double TABUCOL_TIME_LIMIT_SECONDS = 2.0;
+const long long TABUCOL_MAX_ITERATIONS = 5000000;
+
+void writeInstanceResults(InstanceJob &job)
+{
+    std::ofstream outputFile(job.outputFilename);
+    if (!outputFile.is_open())
     {
-        inputFiles.push_back("../Instances/Instance" + std::to_string(i) + "_REG.col");
-        outputFiles.push_back("../ResultsH/output" + std::to_string(i) + "_REG.txt");
+        std::lock_guard<std::mutex> lock(consoleMutex);
+        std::cerr << "Erro ao abrir o arquivo de saída " << job.outputFilename << ".\n";
+        return;
     }
-    for (int i = 1; i <= 10; i++)
+
+    outputFile << "Limite inferior (clique): " << job.clique.size() << (job.clique.exact ? " (clique máximo)" : "") << "\n";
+    if (job.reduction)
     {
-        inputFiles.push_back("../Instances/Instance" + std::to_string(i) + "_SGB.txt");
-        outputFiles.push_back("../ResultsH/output" + std::to_string(i) + "_SGB.txt");
+        outputFile << "Redução: " << job.graph->getNumVertices() << " -> " << job.reduction->core().getNumVertices()
+                   << " vértices (" << job.reduction->getNumPeeled() << " por grau, " << job.reduction->getNumDominated()
+                   << " dominados); os resultados abaixo são do núcleo\n";
     }
+    outputFile << "\n=== Resultados da Busca Local ===\n";
+    outputFile << job.localSearchOutput.str();
+    outputFile << "\n=== Resultados da Têmpera Simulada ===\n";
+    for (int k = 0; k < ANNEALING_NEIGHBORHOODS; ++k)
+    {
+        outputFile << "\nVizinho " << k + 1 << ":\n";
+        outputFile << job.annealingOutput[k].str();
+    }
+    outputFile << "\n=== Resultados do TabuCol ===\n";
+    outputFile << job.tabuColOutput.str();
+    outputFile.close();
 
-    // Processa cada arquivo
-    for (size_t i = 0; i < inputFiles.size(); ++i)
+    std::lock_guard<std::mutex> lock(consoleMutex);
+    std::cout << "Resultados salvos em " << job.outputFilename << "\n";
+}
+
+std::string instanceFile(const InstanceJob &job, const std::string &directory, const std::string &suffix)
+{
+    return (std::filesystem::path(directory) / (std::filesystem::path(job.inputFilename).filename().string() + suffix)).string();
+}
+
+void recordRun(InstanceJob &job, const std::string &algorithm, const std::string &neighborhood, uint64_t seed,
+               double wallMs, long long iterations, const std::vector<int> &coloring, SearchBudget::StopReason stopReason)
+{
+    if (resultWriter == nullptr && savedColoringsDirectory.empty())
+        return;
+
+    RunRecord record;
+    record.instance = std::filesystem::path(job.inputFilename).filename().string();
+    record.algorithm = algorithm;
+    record.neighborhood = neighborhood;
+    record.seed = seed;
+    record.wallMs = wallMs;
+    record.iterations = iterations;
+    // O registro é sempre do grafo original: a coloração dos solvers é desrenumerada e estendida antes
+    std::vector<int> fullColoring = job.toOriginal(coloring);
+    ColoringReport verification = job.verifier->verify(fullColoring);
+    record.colors = verification.colorSpan();
+    record.conflicts = static_cast<int>(verification.conflicts);
+
+    if (!savedColoringsDirectory.empty() && record.conflicts == 0)
     {
-        const std::string &inputFilename = inputFiles[i];
-        const std::string &outputFilename = outputFiles[i];
+        std::lock_guard<std::mutex> lock(job.bestMutex);
+        if (job.bestColoring.empty() || record.colors < *std::max_element(job.bestColoring.begin(), job.bestColoring.end()) + 1)
+            job.bestColoring = fullColoring;
+    }
+    if (resultWriter == nullptr)
+        return;
 
-        // Ler o arquivo e carregar o grafo
-        InstanceReader reader(inputFilename);
-        int numVertices = reader.getNumVertices();
-        const auto &edges = reader.getEdges();
+    record.stopReason = SearchBudget::describe(stopReason);
+    record.lowerBound = job.clique.size();
+    record.coloring = &fullColoring;
+    resultWriter->write(record);
+}
+
+double millisecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
 
-        // Converter edges para std::vector<std::pair<int, int>>
-        std::vector<std::pair<int, int>> edgePairs;
-        for (const auto &edge : edges)
+void finishSolverJob(InstanceJob &job)
+{
+    if (job.remaining.fetch_sub(1) == 1)
+    {
+        writeInstanceResults(job);
+        if (!savedColoringsDirectory.empty() && !job.bestColoring.empty())
         {
-            if (edge.size() == 2)
+            try
+            {
+                ColoringFile::write(instanceFile(job, savedColoringsDirectory, ".coloring"), job.bestColoring);
+            }
+            catch (const std::exception &e)
             {
-                edgePairs.emplace_back(edge[0], edge[1]);
+                std::lock_guard<std::mutex> lock(consoleMutex);
+                std::cerr << "Erro: " << e.what() << "\n";
             }
         }
+        job.warmStart.clear();
+        job.bestColoring.clear();
+        job.ordering.reset();
+        job.reduction.reset();
+        job.verifier.reset();
+        job.graph.reset();
+    }
+}
+
+// Roda uma configuração de solver e a conta como terminada mesmo se ela lançar: o
+// erro vai para o stream da configuração e para o console, e o último job ainda
+// monta o arquivo da instância.
+template <typename Body>
+void runSolverJob(InstanceJob &job, std::ostream &output, const std::string &solver, Body body)
+{
+    try
+    {
+        body();
+    }
+    catch (const std::exception &e)
+    {
+        output << "Erro: " << e.what() << "\n";
+        std::lock_guard<std::mutex> lock(consoleMutex);
+        std::cerr << "Erro em " << solver << " (" << job.inputFilename << "): " << e.what() << "\n";
+    }
+    finishSolverJob(job);
+}
+
+// Lê a instância e enfileira uma tarefa por configuração de solver.
+void scheduleInstance(WorkStealingPool &pool, InstanceJob &job)
+{
+    try
+    {
+        InstanceReader reader(job.inputFilename);
+        job.graph = std::make_shared<const Graph>(reader.takeGraph());
+
+        // Com o limite do clique os solvers param assim que a coloração é provadamente ótima
+        job.clique = CliqueBound::lowerBound(*job.graph);
+        job.budget = solverBudget;
+        job.budget.setLowerBound(job.clique.size());
+        if (resultWriter != nullptr || !savedColoringsDirectory.empty())
+            job.verifier = std::make_shared<const ColoringVerifier>(*job.graph);
+        if (reduceInstances)
+            job.reduction = std::make_shared<const GraphReduction>(*job.graph, job.clique.size());
+        if (vertexOrder != VertexOrder::None)
+            job.ordering = std::make_shared<const VertexOrdering>(job.reducedGraph(), vertexOrder);
+
+        std::string warmStartFile;
+        if (!warmStartDirectory.empty() && std::filesystem::exists(instanceFile(job, warmStartDirectory, ".coloring")))
+        {
+            warmStartFile = instanceFile(job, warmStartDirectory, ".coloring");
+            std::vector<int> coloring = ColoringFile::read(warmStartFile);
+            if (static_cast<int>(coloring.size()) != job.graph->getNumVertices())
+                throw std::runtime_error(warmStartFile + ": coloração com " + std::to_string(coloring.size()) + " vértices");
+            job.warmStart = job.toSolver(coloring);
+        }
 
-        // Inicializar o grafo com o número de vértices para busca local
-        GraphColoring_LocalSearch localSearchGraph(numVertices);
+        std::lock_guard<std::mutex> lock(consoleMutex);
+        std::cout << job.inputFilename << " carregado em " << reader.getLoadTimeMs() << " ms"
+                  << (reader.isFromCache() ? " (cache)" : "") << ", clique " << job.clique.size();
+        if (job.reduction)
+            std::cout << ", núcleo " << job.reduction->core().getNumVertices() << "/" << job.graph->getNumVertices();
+        if (!warmStartFile.empty())
+            std::cout << ", partida de " << warmStartFile;
+        std::cout << "\n";
+    }
+    catch (const std::exception &e)
+    {
+        std::lock_guard<std::mutex> lock(consoleMutex);
+        std::cerr << "Erro ao ler " << job.inputFilename << ": " << e.what() << "\n";
+        return;
+    }
 
-        // Inicializar o grafo para têmpera simulada
-        GraphColoring_SimulatedAnnealing simulatedAnnealingGraph(numVertices, 1000.0, 0.99, 10000);
+    // Núcleo vazio: a extensão já é uma coloração com tantas cores quanto o clique, logo ótima
+    if (job.reduction && job.reducedGraph().getNumVertices() == 0)
+    {
+        recordRun(job, "Reduction", "", 0, 0, 0, {}, SearchBudget::StopReason::Optimal);
+        job.localSearchOutput << "Núcleo vazio: coloração ótima obtida pela redução.\n";
+        job.remaining = 1;
+        finishSolverJob(job);
+        return;
+    }
 
-        // Adicionar as arestas aos grafos
-        for (const auto &edge : edgePairs)
+    // Executar a têmpera simulada com os parâmetros da família (ou os adaptativos padrão)
+    for (int k = 0; k < ANNEALING_NEIGHBORHOODS; ++k)
+    {
+        pool.submit([&pool, &job, k]
+                    { runSolverJob(job, job.annealingOutput[k], "SA-N" + std::to_string(k + 1), [&]
+                                   {
+                        uint64_t seed = Xoshiro256::deriveSeed(MASTER_SEED, job.index * ANNEALING_NEIGHBORHOODS + k);
+                        AnnealingParameters parameters = AnnealingTuning::lookup(annealingTuning, AnnealingTuning::familyOf(job.inputFilename), k + 1, annealingDefaults);
+                        GraphColoring_SimulatedAnnealing simulatedAnnealingGraph(job.solverGraph(), parameters.initialTemp, parameters.coolingRate, parameters.maxIterations, job.annealingOutput[k]);
+                        simulatedAnnealingGraph.setParameters(parameters);
+                        simulatedAnnealingGraph.setBudget(job.budget);
+                        simulatedAnnealingGraph.setAcceptance(annealingAcceptance);
+                        if (!job.warmStart.empty())
+                            simulatedAnnealingGraph.setInitialSolution(job.warmStart);
+                        if (!checkpointDirectory.empty())
+                            simulatedAnnealingGraph.setCheckpoint(instanceFile(job, checkpointDirectory, ".SA-N" + std::to_string(k + 1) + ".ckpt"), checkpointInterval);
+                        simulatedAnnealingGraph.setTelemetry(telemetrySink, std::filesystem::path(job.inputFilename).filename().string() + "/SA-N" + std::to_string(k + 1), telemetryInterval);
+                        auto start = std::chrono::steady_clock::now();
+                        simulatedAnnealingGraph.multiStartSimulatedAnnealing(k + 1, ANNEALING_CHAINS, seed, pool);
+                        simulatedAnnealingGraph.printColors();
+                        recordRun(job, "SA", std::to_string(k + 1), seed, millisecondsSince(start), simulatedAnnealingGraph.getIterations(),
+                                  simulatedAnnealingGraph.getColors(), simulatedAnnealingGraph.getStopReason()); }); });
+    }
+
+    pool.submit([&job]
+                { runSolverJob(job, job.tabuColOutput, "TabuCol", [&]
+                               {
+                    GraphColoring_TabuCol tabuColGraph(job.solverGraph(), TABUCOL_TIME_LIMIT_SECONDS, TABUCOL_MAX_ITERATIONS, job.tabuColOutput);
+                    uint64_t seed = Xoshiro256::deriveSeed(MASTER_SEED, job.index);
+                    tabuColGraph.setSeed(seed);
+                    tabuColGraph.setBudget(job.budget);
+                    if (!job.warmStart.empty())
+                        tabuColGraph.setInitialSolution(job.warmStart);
+                    if (!checkpointDirectory.empty())
+                        tabuColGraph.setCheckpoint(instanceFile(job, checkpointDirectory, ".TabuCol.ckpt"), checkpointInterval);
+                    auto start = std::chrono::steady_clock::now();
+                    tabuColGraph.tabuCol();
+                    tabuColGraph.printColors();
+                    recordRun(job, "TabuCol", "", seed, millisecondsSince(start), tabuColGraph.getIterations(),
+                              tabuColGraph.getColors(), tabuColGraph.getStopReason()); }); });
+
+    // A busca local é a configuração mais cara: enviada por último, é a primeira a sair da fila deste worker
+    pool.submit([&pool, &job]
+                { runSolverJob(job, job.localSearchOutput, "LS", [&]
+                               {
+                    GraphColoring_LocalSearch localSearchGraph(job.solverGraph(), job.localSearchOutput);
+                    localSearchGraph.setPool(pool);
+                    localSearchGraph.setBudget(job.budget);
+                    if (!job.warmStart.empty())
+                        localSearchGraph.setInitialSolution(job.warmStart);
+                    localSearchGraph.localSearch();
+                    for (const auto &result : localSearchGraph.getResults())
+                        recordRun(job, "LS", result.name, 0, result.wallMs, result.iterations, result.colors, localSearchGraph.getStopReason()); }); });
+}
+
+// Uso: main [--telemetry <arquivo.csv|.jsonl>] [--telemetry-interval <iterações>] [--time-limit <segundos>]
+//             [--results <arquivo.jsonl|.csv> [--colors <arquivo>]] [--no-reduction]
+//             [--acceptance metropolis|threshold] [--tuning <arquivo>] [--ordering none|degree|rcm]
+//             [--checkpoint-dir <dir> [--checkpoint-interval <segundos>]] [--warm-start <dir>] [--save-colorings <dir>]
+int main(int argc, char **argv)
+{
+    std::string telemetryFilename;
+    std::string resultsFilename;
+    std::string colorsFilename;
+    std::string tuningFilename;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--telemetry" && i + 1 < argc)
+            telemetryFilename = argv[++i];
+        else if (arg == "--telemetry-interval" && i + 1 < argc)
+            telemetryInterval = std::stoll(argv[++i]);
+        else if (arg == "--results" && i + 1 < argc)
+            resultsFilename = argv[++i];
+        else if (arg == "--colors" && i + 1 < argc)
+            colorsFilename = argv[++i];
+        else if (arg == "--acceptance" && i + 1 < argc && (std::string(argv[i + 1]) == "metropolis" || std::string(argv[i + 1]) == "threshold"))
+            annealingAcceptance = std::string(argv[++i]) == "threshold" ? AcceptanceRule::Threshold : AcceptanceRule::Metropolis;
+        else if (arg == "--tuning" && i + 1 < argc)
+            tuningFilename = argv[++i];
+        else if (arg == "--ordering" && i + 1 < argc && (std::string(argv[i + 1]) == "none" || std::string(argv[i + 1]) == "degree" || std::string(argv[i + 1]) == "rcm"))
+            vertexOrder = VertexOrdering::parse(argv[++i]);
+        else if (arg == "--no-reduction")
+            reduceInstances = false;
+        else if (arg == "--checkpoint-dir" && i + 1 < argc)
+            checkpointDirectory = argv[++i];
+        else if (arg == "--checkpoint-interval" && i + 1 < argc)
+            checkpointInterval = std::stod(argv[++i]);
+        else if (arg == "--warm-start" && i + 1 < argc)
+            warmStartDirectory = argv[++i];
+        else if (arg == "--save-colorings" && i + 1 < argc)
+            savedColoringsDirectory = argv[++i];
+        else if (arg == "--time-limit" && i + 1 < argc)
+            solverBudget.setTimeLimit(std::stod(argv[++i]));
+        else
         {
-            localSearchGraph.addEdge(edge.first, edge.second);
-            simulatedAnnealingGraph.addEdge(edge.first, edge.second);
+            std::cerr << "Uso: " << argv[0] << " [--telemetry <arquivo.csv|.jsonl>] [--telemetry-interval <iterações>] [--time-limit <segundos>] [--results <arquivo.jsonl|.csv> [--colors <arquivo>]] [--no-reduction] [--acceptance metropolis|threshold] [--tuning <arquivo>] [--ordering none|degree|rcm (padrão: rcm)] [--checkpoint-dir <dir> [--checkpoint-interval <segundos>]] [--warm-start <dir>] [--save-colorings <dir>]\n";
+            return 1;
         }
+    }
 
-        // Abrir o arquivo de saída
-        std::ofstream outputFile(outputFilename);
-        if (!outputFile.is_open())
+    std::ofstream telemetryFile;
+    std::unique_ptr<TelemetrySink> sink;
+    if (!telemetryFilename.empty())
+    {
+        telemetryFile.open(telemetryFilename);
+        if (!telemetryFile.is_open())
         {
-            std::cerr << "Erro ao abrir o arquivo de saída " << outputFilename << ".\n";
-            continue;
+            std::cerr << "Erro ao abrir o arquivo de telemetria " << telemetryFilename << ".\n";
+            return 1;
         }
+        sink = std::make_unique<TelemetrySink>(telemetryFile, TextFormat::formatFor(telemetryFilename));
+        telemetrySink = sink.get();
+    }
 
-        // Redirecionar saída padrão para o arquivo
-        auto originalBuffer = std::cout.rdbuf();
-        std::cout.rdbuf(outputFile.rdbuf());
+    std::unique_ptr<ResultWriter> writer;
+    if (!resultsFilename.empty())
+    {
+        try
+        {
+            writer = std::make_unique<ResultWriter>(resultsFilename, colorsFilename);
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Erro: " << e.what() << "\n";
+            return 1;
+        }
+        resultWriter = writer.get();
+    }
 
-        // Executar a busca local
-        std::cout << "\n=== Resultados da Busca Local ===\n";
-        localSearchGraph.localSearch();
+    if (!tuningFilename.empty())
+    {
+        try
+        {
+            annealingTuning = AnnealingTuning::load(tuningFilename);
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Erro: " << e.what() << "\n";
+            return 1;
+        }
+    }
 
-        // Executar a têmpera simulada com os melhores parâmetros encontrados
-        std::cout << "\n=== Resultados da Têmpera Simulada ===\n";
-        std::cout << "\nVizinho 1:\n";
-        simulatedAnnealingGraph.simulatedAnnealing(1);
-        simulatedAnnealingGraph.printColors();
+    for (const std::string &directory : {checkpointDirectory, savedColoringsDirectory})
+    {
+        std::error_code error;
+        if (!directory.empty() && !std::filesystem::create_directories(directory, error) && error)
+        {
+            std::cerr << "Erro ao criar o diretório " << directory << ": " << error.message() << "\n";
+            return 1;
+        }
+    }
+
+    // Lista de arquivos de entrada e saída
+    std::vector<std::string> inputFiles;
+    std::vector<std::string> outputFiles;
+
+    for (int i = 1; i <= 12; i++)
+    {
+        inputFiles.push_back("../Instances/Instance" + std::to_string(i) + "_450_LEI.txt");
+        outputFiles.push_back("../ResultsH/output" + std::to_string(i) + "_450_LEI.txt");
+    }
+    for (int i = 1; i <= 5; i++)
+    {
+        inputFiles.push_back("../Instances/Instance" + std::to_string(i) + "_MYC.txt");
+        outputFiles.push_back("../ResultsH/output" + std::to_string(i) + "_MYC.txt");
+    }
+    for (int i = 1; i <= 14; i++)
+    {
+        inputFiles.push_back("../Instances/Instance" + std::to_string(i) + "_REG.col");
+        outputFiles.push_back("../ResultsH/output" + std::to_string(i) + "_REG.txt");
+    }
+    for (int i = 1; i <= 10; i++)
+    {
+        inputFiles.push_back("../Instances/Instance" + std::to_string(i) + "_SGB.txt");
+        outputFiles.push_back("../ResultsH/output" + std::to_string(i) + "_SGB.txt");
+    }
 
-        std::cout << "\nVizinho 2:\n";
-        simulatedAnnealingGraph.simulatedAnnealing(2);
-        simulatedAnnealingGraph.printColors();
+    std::vector<std::unique_ptr<InstanceJob>> jobs;
+    for (size_t i = 0; i < inputFiles.size(); ++i)
+    {
+        auto job = std::make_unique<InstanceJob>();
+        job->index = i;
+        job->inputFilename = inputFiles[i];
+        job->outputFilename = outputFiles[i];
 
-        std::cout << "\nVizinho 3:\n";
-        simulatedAnnealingGraph.simulatedAnnealing(3);
-        simulatedAnnealingGraph.printColors();
+        std::error_code error;
+        auto size = std::filesystem::file_size(job->inputFilename, error);
+        job->fileSize = error ? 0 : static_cast<long long>(size);
+        jobs.push_back(std::move(job));
+    }
 
-        // Restaurar a saída padrão
-        std::cout.rdbuf(originalBuffer);
-        outputFile.close();
+    // Maiores instâncias primeiro, para que a mais lenta não fique para o fim
+    std::stable_sort(jobs.begin(), jobs.end(), [](const std::unique_ptr<InstanceJob> &a, const std::unique_ptr<InstanceJob> &b)
+                     { return a->fileSize > b->fileSize; });
 
-        std::cout << "Resultados salvos em " << outputFilename << "\n";
+    WorkStealingPool pool;
+    for (auto &job : jobs)
+    {
+        InstanceJob *current = job.get();
+        pool.submit([&pool, current]
+                    { scheduleInstance(pool, *current); });
     }
+    pool.wait();
+    if (sink)
+        sink->flush();
+    if (writer)
+        writer->flush();
 
     return 0;
 }